@@ -0,0 +1,44 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// minimal timing helpers for the benchmarks of the library (each benchmark is a small executable).
+namespace bench {
+	// number of times each measurement is repeated, the fastest run is reported.
+	inline constexpr int repeats = 5;
+
+	// keep a result alive, so the compiler does not remove the measured work.
+	template <typename T>
+	inline void keep(const T& value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+	/**
+	 * run func a few times and print the fastest run.
+	 * @tparam Func - callable as func().
+	 * @param name - name of the measurement.
+	 * @param operations - number of operations func does (the report is per operation).
+	 * @param func - the measured work.
+	 * @return the fastest run in nanoseconds per operation.
+	 */
+	template <typename Func>
+	double measure(const std::string& name, const size_t operations, Func&& func) {
+		double best{};
+		for (int i = 0; i < repeats; i++) {
+			const auto start = std::chrono::steady_clock::now();
+			func();
+			const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+			const double per_operation = elapsed.count() / static_cast<double>(std::max<size_t>(operations, 1));
+			best = i == 0 ? per_operation : std::min(best, per_operation);
+		}
+		std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(12) << best << " ns/op" << std::endl;
+		return best;
+	}
+}
+
+#endif // BENCH_H
@@ -0,0 +1,64 @@
+#include "Bench.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Char_Scanner.h"
+
+// build csv data like the catalog files: rows of 4 cells.
+static std::string make_csv(const size_t rows) {
+	std::string data{};
+	for (size_t i = 0; i < rows; i++) {
+		data += std::to_string(10000 + i % 90000) + ",Course name " + std::to_string(i) + ",123456789,5.000000\n";
+	}
+	return data;
+}
+
+// count the matches and sum their positions (so both scanners can be compared).
+struct Matches {
+	size_t count{};
+	size_t position_sum{};
+
+	void operator()(const size_t pos) {
+		++count;
+		position_sum += pos;
+	}
+};
+
+int main() {
+	const std::string data = make_csv(200000);
+	std::cout << "Char_Scanner: " << data.size() << " bytes of csv, ns per byte" << std::endl;
+
+	Matches simd{};
+	Matches scalar{};
+	const double simd_time = bench::measure("for_each_match (simd dispatch)", data.size(), [&] {
+		simd = {};
+		Char_Scanner::for_each_match(data, ',', '\n', [&simd](const size_t pos) { simd(pos); });
+		bench::keep(simd);
+	});
+	const double scalar_time = bench::measure("for_each_match_scalar", data.size(), [&] {
+		scalar = {};
+		Char_Scanner::for_each_match_scalar(data, ',', '\n', [&scalar](const size_t pos) { scalar(pos); });
+		bench::keep(scalar);
+	});
+
+	// a buffer without matches shows the cost of the scan itself.
+	const std::string plain(data.size(), 'x');
+	size_t none{};
+	bench::measure("for_each_match, no matches", plain.size(), [&] {
+		Char_Scanner::for_each_match(plain, ',', '\n', [&none](const size_t) { ++none; });
+		bench::keep(none);
+	});
+	bench::measure("for_each_match_scalar, no matches", plain.size(), [&] {
+		Char_Scanner::for_each_match_scalar(plain, ',', '\n', [&none](const size_t) { ++none; });
+		bench::keep(none);
+	});
+
+	std::cout << "speedup: " << scalar_time / simd_time << "x" << std::endl;
+	if (simd.count != scalar.count || simd.position_sum != scalar.position_sum || none != 0) {
+		std::cerr << "Error: the scanners found different matches." << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+#include "Bench.h"
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Entity_Store.h"
+#include "Symbol_Table.h"
+#include "data/Course.h"
+#include "data/course_types/Lecture.h"
+
+// number of courses in the store, and of lookups in each measurement.
+static constexpr size_t course_count = 20000;
+static constexpr size_t lookup_count = 1000000;
+// number of course types of each course (group ids 01 - 12).
+static constexpr size_t group_count = 12;
+
+static std::string make_group_id(const size_t group) {
+	return (group < 9 ? "0" : "") + std::to_string(group + 1);
+}
+
+int main() {
+	// the courses of the catalog, as Entity_Manager keeps them (get_entity<Course>(id) is a lookup in this store).
+	Entity_Store<Course> store{};
+	std::vector<std::string> ids{};
+	for (size_t i = 0; i < course_count; i++) {
+		ids.push_back(std::to_string(10000 + i));
+		Course* course = new Course(ids.back(), "Course " + ids.back(), "Bob", 5);
+		for (size_t group = 0; group < group_count; group++) {
+			course->add_course_type(new Lecture(make_group_id(group), "Sunday", "10:00", 90, "Bob", "A101"));
+		}
+		store.add(course);
+	}
+	// the ids of the lookups, as views of a command line (like the tokens of a batch file).
+	std::vector<std::string_view> tokens{};
+	for (size_t i = 0; i < lookup_count; i++) { tokens.push_back(ids[i * 7919 % course_count]); }
+	std::vector<Symbol_Table::Handle> handles{};
+	for (const std::string_view token : tokens) { handles.push_back(Symbol_Table::get_instance().find(token)); }
+	std::cout << "Entity lookups: " << course_count << " courses with " << group_count << " course types each"
+		<< std::endl;
+
+	// the baseline, the entities keyed by a copy of their id (as Entity_Manager kept them before the store).
+	std::unordered_map<std::string, Entity*> baseline{};
+	for (Course* entity : store) { baseline.emplace(entity->get_id(), entity); }
+
+	size_t found{};
+	bench::measure("unordered_map<string, Entity*>", lookup_count, [&] {
+		for (const std::string_view token : tokens) { found += baseline.find(std::string{token}) != baseline.end(); }
+		bench::keep(found);
+	});
+	bench::measure("get_entity(string_view)", lookup_count, [&] {
+		for (const std::string_view token : tokens) { found += store.get(token) != nullptr; }
+		bench::keep(found);
+	});
+	// the lookup before get_entity took a view, a string was made from each token.
+	bench::measure("get_entity(std::string{token})", lookup_count, [&] {
+		for (const std::string_view token : tokens) { found += store.get(std::string{token}) != nullptr; }
+		bench::keep(found);
+	});
+	bench::measure("get_entity(handle)", lookup_count, [&] {
+		for (const Symbol_Table::Handle handle : handles) { found += store.get(handle) != nullptr; }
+		bench::keep(found);
+	});
+
+	// the group ids of the course type lookups.
+	std::vector<std::string> groups{};
+	for (size_t group = 0; group < group_count; group++) { groups.push_back(make_group_id(group)); }
+	std::vector<Symbol_Table::Handle> group_handles{};
+	for (const std::string& group : groups) { group_handles.push_back(Symbol_Table::get_instance().find(group)); }
+	const Course* course = store.get(ids.front());
+	bench::measure("Course::get_course_type(string_view)", lookup_count, [&] {
+		for (size_t i = 0; i < lookup_count; i++) {
+			found += course->get_course_type(std::string_view{groups[i % group_count]}) != nullptr;
+		}
+		bench::keep(found);
+	});
+	bench::measure("Course::get_course_type(handle)", lookup_count, [&] {
+		for (size_t i = 0; i < lookup_count; i++) {
+			found += course->get_course_type(group_handles[i % group_count]) != nullptr;
+		}
+		bench::keep(found);
+	});
+
+	// every lookup must find its entity (6 measurements of each lookup).
+	const bool all_found = found == lookup_count * bench::repeats * 6;
+	for (Course* entity : std::vector<Course*>{store.begin(), store.end()}) { delete entity; }
+	store.clear();
+	if (!all_found) {
+		std::cerr << "Error: a lookup did not find its entity." << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
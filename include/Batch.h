@@ -0,0 +1,76 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+class User; // forward declaration since it used as a pointer.
+
+/*Batch class runs the commands of a file or of the standard input one after another, without prompts
+(FinalProject --batch [commands file]), for scripts like a nightly import of the catalog.
+a login line starts the commands: "admin [password]" or "student [id] [password]",
+the other lines are commands like in the CLI, and after Logout the next line logs in again.
+empty lines and lines that start with # are skipped,
+Exit (or the end of the input) ends the batch and saves the catalog.
+the output of the commands is buffered and written in large blocks (std::endl does not flush it),
+and every login and command is followed by a status line for the scripts:
+@status<TAB>line<TAB>ok|failed<TAB>command, and the batch ends with @summary<TAB>commands<TAB>failed.
+note: the errors of the commands are written to std::cerr like in the CLI (unbuffered, so they may come first).*/
+class Batch {
+	// buffer of std::cout, written to a file descriptor only when it is full or when the batch ends.
+	class Output_Buffer : public std::streambuf {
+		int m_fd{};
+		std::vector<char> m_buffer{};
+
+	protected:
+		int_type overflow(int_type ch) override;
+		// std::endl syncs the stream after every line, the buffer is not written for it.
+		int sync() override { return 0; }
+
+	public:
+		Output_Buffer(int fd, size_t size);
+		// write the buffered output to the file descriptor.
+		void write_buffer();
+	};
+
+	// size of the output buffer.
+	static constexpr size_t output_buffer_size = 1024 * 1024;
+
+	std::istream& m_input;
+	User* m_user{}; // the logged in user, nullptr before the login.
+	std::string m_admin_password{"admin"}; // default admin password.
+
+	size_t m_line{}; // number of the line that is processed.
+	size_t m_commands{}; // number of logins and commands that ran.
+	size_t m_failed{}; // number of logins and commands that failed.
+
+	// flag to check if the batch is running (until Exit).
+	bool m_running{true};
+
+	// log in with a login line ("admin [password]" or "student [id] [password]").
+	bool login(const std::vector<std::string>& words);
+
+	// run a command of the logged in user (like CLI::process_command()), false when it failed.
+	bool run_command(const std::string& command, const std::vector<std::string>& args);
+
+	// print the status line of a login or a command.
+	void report(const std::string& command, bool succeeded);
+
+public:
+	// constructor and destructor.
+	explicit Batch(std::istream& input);
+	// no need for a copy constructor since there is one batch per input.
+	Batch(const Batch&) = delete;
+	Batch& operator=(const Batch&) = delete;
+	~Batch();
+
+	// run the commands of the input and save the catalog, true if all the logins and commands succeeded.
+	bool run();
+
+	// delete the logged in user.
+	void clean_up();
+};
+
+#endif //BATCH_H
@@ -22,13 +22,24 @@ class CLI {
 	// process for creating a command object and execute it.
 	void process_command(const std::string& input);
 
-	// split a input into command and arguments.
+public:
+	// split a input into command and arguments (shared with the sessions of the Server).
 	static std::vector<std::string> split_input(const std::string& input);
 
 	// change command case specific (first letter upper case, rest lower case).
 	static std::string change_command_case(const std::string& command);
 
-public:
+	/**
+	 * check the answers of a login and create its user (shared with the sessions of the Server and the Batch).
+	 * @param username - admin or student.
+	 * @param id - the student id (ignored for the admin).
+	 * @param password - the password of the admin or of the student.
+	 * @param admin_password - the current admin password of the session.
+	 * @return the new user, nullptr if the login is invalid (the error is logged).
+	 */
+	static User* create_user(const std::string& username, const std::string& id, const std::string& password,
+	                         const std::string& admin_password);
+
 	// constructor and destructor.
 	CLI();
 	// no eed for a copy constructor since we don't want to copy the CLI object.
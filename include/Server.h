@@ -0,0 +1,133 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class User; // forward declaration since it used as a pointer.
+
+/*Server class serves many users over a local Unix domain socket (FinalProject --server [socket path]).
+the catalog is loaded once for all the sessions, so a session starts with a connect instead of a catalog load.
+each connection is a session with its own user (Admin_User or Student_User), that logs in and runs commands
+like in the CLI, and the output of a command (std::cout and std::cerr) is sent to the connection that ran it.
+the connections are served by one epoll event loop, a command runs to its end before the next one starts,
+so the commands of the sessions do not interleave their output, and they take the catalog locks like in the CLI.
+note: a client sends lines (see src/client/Client.cpp), and it can send many commands at once,
+the session runs them in order and closes once the client is done sending and all the output was sent.*/
+class Server {
+public:
+	// the default socket, in the directory the server runs in.
+	static constexpr const char* default_socket_path = "scheduler.sock";
+
+private:
+	// a connection of a client and its session.
+	struct Session {
+		// the login question the session waits for (like CLI::login()), then commands.
+		enum class State : uint8_t { user_type, student_id, password, change_password, new_password, commands };
+
+		State state{State::user_type};
+		std::string user_type{}; // admin or student.
+		std::string id{}; // student id.
+		// the admin password of the session, a change lasts until the session ends (like in the CLI).
+		std::string admin_password{"admin"};
+		User* user{}; // the logged in user, nullptr before the login.
+
+		std::string input{}; // received bytes that are not processed yet.
+		std::string output{}; // output that is not sent yet, from output_offset.
+		size_t output_offset{};
+		uint32_t events{}; // the epoll events the connection waits for.
+		bool peer_closed{false}; // the client is done sending.
+		bool exited{false}; // the session ran Exit, the rest of the input is ignored.
+	};
+
+	// redirects std::cout and std::cerr to a stream while it lives, so the output of a command goes to its session.
+	class Output_Capture {
+		std::streambuf* m_cout{};
+		std::streambuf* m_cerr{};
+
+	public:
+		explicit Output_Capture(std::ostream& stream);
+		Output_Capture(const Output_Capture&) = delete;
+		Output_Capture& operator=(const Output_Capture&) = delete;
+		~Output_Capture();
+	};
+
+	// maximum number of epoll events handled in one wait.
+	static constexpr int max_events = 64;
+	// maximum size of the received input that is not processed yet, a longer line closes the connection.
+	static constexpr size_t max_input_size = 64 * 1024;
+	// output a session may have waiting for a slow client, no more commands are run or read until it is sent.
+	static constexpr size_t max_pending_output = 1024 * 1024;
+
+	std::string m_socket_path{};
+	int m_listen_fd{-1};
+	int m_epoll_fd{-1};
+	int m_signal_fd{-1}; // SIGINT and SIGTERM, to stop the server.
+
+	// sessions by the file descriptor of their connection.
+	std::unordered_map<int, Session> m_sessions{};
+
+	// flag to check if the server is running.
+	bool m_running{true};
+
+	// create the socket, the epoll instance and the signal file descriptor (throws if one of them fails).
+	void setup();
+
+	// add a file descriptor to the epoll instance (throws if it fails).
+	void watch(int fd, uint32_t events) const;
+
+	// accept the waiting connections and greet them.
+	void accept_sessions();
+
+	// handle the epoll events of a connection, and close it once it is done.
+	void handle_session(int fd, uint32_t events);
+
+	// receive the bytes the client sent, false if the connection failed.
+	static bool receive(int fd, Session& session);
+
+	// send the output that is waiting, as much as the socket takes, false if the connection failed.
+	static bool send_output(int fd, Session& session);
+
+	// process the received lines, until the session has too much output waiting.
+	void process_input(Session& session);
+
+	// process a line, as login answers (words) or as a command.
+	void process_line(Session& session, std::string_view line);
+
+	// process a login answer and ask the next question (like CLI::login()).
+	static void process_login(Session& session, const std::string& answer);
+
+	// start over the login after an invalid answer.
+	static void reject_login(Session& session);
+
+	// start the commands of a logged in user.
+	static void start_commands(Session& session);
+
+	// run a command of a logged in user (like CLI::process_command()).
+	static void process_command(Session& session, const std::string& input);
+
+	// update the epoll events a connection waits for.
+	void update_events(int fd, Session& session) const;
+
+	// delete the user of a session and close its connection.
+	void close_session(int fd);
+
+public:
+	// constructor and destructor.
+	explicit Server(const std::string& socket_path = default_socket_path);
+	// no need for a copy constructor since the server owns the socket.
+	Server(const Server&) = delete;
+	Server& operator=(const Server&) = delete;
+	~Server();
+
+	// load the catalog and serve the sessions until SIGINT or SIGTERM, then save the catalog.
+	void run();
+
+	// close the sessions, the socket and remove the socket file.
+	void clean_up();
+};
+
+#endif //SERVER_H
@@ -4,11 +4,17 @@
 #include <string>
 #include <vector>
 
+#include "../../libs/SchedulerLib/include/System_Operations.h"
+
 // User class represents an abstract class for all users.
 class User {
 protected:
 	// protected field and methods so they can be used in derived classes.
 	std::string m_password{}; // password of the user.
+	// the paged listing of the session (Printcourse, Printalllecturers, Printallstudents), continued by More.
+	System_Operations::Page_Cursor m_page_cursor{};
+	// number of lecturers or students per page of Printalllecturers and Printallstudents.
+	static constexpr size_t all_page_size = 100;
 
 	// constructors and destructor.
 	User(const std::string& password);
@@ -2,13 +2,28 @@
 #define CSV_EDITOR_H
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Char_Scanner.h"
 
 // CSV Editor is a static utility class to read and write csv files.
 // it does this by using std::vector<std::vector<std::string>> as a vector of rows (each row is a vector of cells).
 class CSV_Editor {
 	// delimiter for csv files.
 	static const char delimiter = ',';
+	// directory of all csv files (relative to the working directory).
+	static constexpr const char* resources_dir = "../resources/";
+	// default size of the buffer used by stream_csv.
+	static constexpr size_t stream_chunk_size = 64 * 1024;
+	// utf-8 byte order mark, some editors write it at the start of a csv file.
+	static constexpr std::string_view byte_order_mark = "\xEF\xBB\xBF";
 
 	// private constructor and destructor to prevent instantiation.
 	CSV_Editor() = default;
@@ -20,7 +35,157 @@ class CSV_Editor {
 	static std::string join(const std::vector<std::string>& row);
 
 public:
+	// get the delimiter of the csv files.
+	static char get_delimiter() { return delimiter; }
+
+	// get the path of a csv file in the resources directory.
+	static std::string get_path(const std::string& file_name) { return resources_dir + file_name; }
+
+	// remove the utf-8 byte order mark from the start of the data of a file (like read_csv does).
+	static std::string_view skip_byte_order_mark(std::string_view data) {
+		if (data.substr(0, byte_order_mark.size()) == byte_order_mark) { data.remove_prefix(byte_order_mark.size()); }
+		return data;
+	}
+
+	// split line into cells as views into the line (no allocation per cell).
+	// cells is cleared first, so the same vector can be reused for every line.
+	static void split(const std::string_view line, std::vector<std::string_view>& cells) {
+		cells.clear();
+		size_t start{};
+		Char_Scanner::for_each_match(line, delimiter, delimiter, [&](const size_t end) {
+			cells.push_back(line.substr(start, end - start));
+			start = end + 1;
+		});
+		cells.push_back(line.substr(start));
+	}
+
+	/**
+	 * call func for every complete non empty row in data.
+	 * the delimiters and line breaks of the whole buffer are found in one pass (see Char_Scanner).
+	 * @tparam Func - callable as func(const std::vector<std::string_view>& row).
+	 * @param data - buffer with csv lines.
+	 * @param is_last - true if data is the end of the file, else a last line without a new line is not
+	 * consumed since it may continue in the next chunk.
+	 * @param cells - reused vector for the cells of the current row.
+	 * @param func - function to call for each row.
+	 * @return number of bytes of data that were consumed.
+	 */
+	template <typename Func>
+	static size_t parse_rows(const std::string_view data, const bool is_last, std::vector<std::string_view>& cells,
+	                         Func& func) {
+		size_t start{}; // start of the current line.
+		size_t cell_start{}; // start of the current cell.
+		cells.clear();
+		// the current line ends at end, hand it to func.
+		auto end_row = [&](const size_t end) {
+			cells.push_back(data.substr(cell_start, end - cell_start));
+			cell_start = end + 1;
+			start = end + 1;
+			// ignore windows line endings and empty lines.
+			std::string_view& last = cells.back();
+			if (!last.empty() && last.back() == '\r') { last.remove_suffix(1); }
+			if (cells.size() > 1 || !last.empty()) { func(static_cast<const std::vector<std::string_view>&>(cells)); }
+			cells.clear();
+		};
+		Char_Scanner::for_each_match(data, delimiter, '\n', [&](const size_t pos) {
+			if (data[pos] == '\n') {
+				end_row(pos);
+				return;
+			}
+			cells.push_back(data.substr(cell_start, pos - cell_start));
+			cell_start = pos + 1;
+		});
+		// keep the partial line for the next chunk.
+		if (start < data.size()) {
+			if (!is_last) { return start; }
+			end_row(data.size());
+		}
+		return data.size();
+	}
+
+	/**
+	 * split csv data into chunks of whole rows, so the chunks can be parsed separately (see parse_rows).
+	 * each chunk but the last ends right after a line break.
+	 * @param data - buffer with csv lines.
+	 * @param count - number of chunks to split into (fewer if data has fewer lines).
+	 * @return the chunks in the order of the data.
+	 */
+	static std::vector<std::string_view> split_chunks(const std::string_view data, const size_t count) {
+		std::vector<std::string_view> chunks{};
+		const size_t target_size = count > 0 ? data.size() / count : data.size();
+		size_t start{};
+		while (start < data.size()) {
+			size_t end = start + target_size;
+			if (chunks.size() + 1 >= count || end >= data.size()) { end = data.size(); }
+			else {
+				// move the end of the chunk to the end of the row.
+				end = data.find('\n', end);
+				end = end == std::string_view::npos ? data.size() : end + 1;
+			}
+			chunks.push_back(data.substr(start, end - start));
+			start = end;
+		}
+		return chunks;
+	}
+
+	/**
+	 * stream csv file row by row into func, only one chunk of the file is buffered at a time.
+	 * the cells are views into the chunk, so func must copy what it wants to keep.
+	 * note: if a single row is longer than the chunk, the chunk grows to fit it.
+	 * a missing file is created empty and has no rows, and a byte order mark is skipped (like read_csv).
+	 * @tparam Func - callable as func(const std::vector<std::string_view>& row).
+	 * @param file_name - name of the csv file.
+	 * @param func - function to call for each row.
+	 * @param chunk_size - size of the read buffer in bytes.
+	 */
+	template <typename Func>
+	static void stream_csv(const std::string& file_name, Func&& func, const size_t chunk_size = stream_chunk_size) {
+		const std::string path = get_path(file_name);
+		const int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			if (errno != ENOENT) { throw std::runtime_error("Error: could not open file " + path); }
+			create_csv(file_name);
+			return;
+		}
+
+		std::vector<char> buffer(chunk_size > 0 ? chunk_size : stream_chunk_size);
+		std::vector<std::string_view> cells{};
+		size_t filled{}; // bytes of buffer that hold unprocessed data.
+		bool is_first{true}; // true until the start of the file was parsed.
+		try {
+			while (true) {
+				if (filled == buffer.size()) { buffer.resize(buffer.size() * 2); }
+				const ssize_t count = read(fd, buffer.data() + filled, buffer.size() - filled);
+				if (count < 0) {
+					if (errno == EINTR) { continue; }
+					throw std::runtime_error("Error: could not read file " + path);
+				}
+				filled += static_cast<size_t>(count);
+				const bool is_last = count == 0;
+				const std::string_view data{buffer.data(), filled};
+				size_t skipped{}; // bytes of the byte order mark at the start of the file.
+				if (is_first) {
+					// wait for enough of the file to tell if it starts with a byte order mark.
+					if (filled < byte_order_mark.size() && !is_last) { continue; }
+					is_first = false;
+					skipped = data.size() - skip_byte_order_mark(data).size();
+				}
+				const size_t consumed = skipped + parse_rows(data.substr(skipped), is_last, cells, func);
+				// move the partial line to the front of the buffer.
+				std::memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+				filled -= consumed;
+				if (is_last) { break; }
+			}
+		}
+		catch (...) {
+			close(fd);
+			throw;
+		}
+		close(fd);
+	}
+
 	// read csv file and return data as vector of rows (each row is a vector of cells).
+	// note: see stream_csv and CSV_View for readers that do not allocate per cell.
 	static std::vector<std::vector<std::string>> read_csv(const std::string& file_name);
 
 	// write csv file with data (vector of rows, each row is a vector of cells).
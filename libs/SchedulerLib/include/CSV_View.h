@@ -0,0 +1,108 @@
+#ifndef CSV_VIEW_H
+#define CSV_VIEW_H
+
+#include <cerrno>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CSV_Editor.h"
+
+// CSV View is a read only memory mapping of a csv file.
+// rows are handed out as std::string_view cells that point straight into the mapping,
+// so reading a file does not allocate a std::string per cell like CSV_Editor::read_csv.
+// note: the views are only valid while the CSV_View object is alive.
+class CSV_View {
+	const char* m_data{}; // start of the mapped file (nullptr for an empty file).
+	size_t m_size{}; // size of the mapped file in bytes.
+
+	CSV_View(const char* data, const size_t size) : m_data{data}, m_size{size} {}
+
+	// unmap the file (if mapped).
+	void clean_up() {
+		if (m_data) { munmap(const_cast<char*>(m_data), m_size); }
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+public:
+	// empty view (nothing mapped).
+	CSV_View() = default;
+	// no copy since the mapping has a single owner, but it can be moved.
+	CSV_View(const CSV_View&) = delete;
+	CSV_View& operator=(const CSV_View&) = delete;
+	CSV_View(CSV_View&& other) noexcept : m_data{other.m_data}, m_size{other.m_size} {
+		other.m_data = nullptr;
+		other.m_size = 0;
+	}
+	CSV_View& operator=(CSV_View&& other) noexcept {
+		if (this != &other) {
+			clean_up();
+			m_data = other.m_data;
+			m_size = other.m_size;
+			other.m_data = nullptr;
+			other.m_size = 0;
+		}
+		return *this;
+	}
+	~CSV_View() { clean_up(); }
+
+	/**
+	 * map a csv file from the resources directory into memory.
+	 * a missing file is created empty and maps to an empty view (like CSV_Editor::read_csv).
+	 * @param file_name - name of the csv file.
+	 * @return the mapped csv file.
+	 */
+	static CSV_View map(const std::string& file_name) {
+		const std::string path = CSV_Editor::get_path(file_name);
+		const int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			if (errno != ENOENT) { throw std::runtime_error("Error: could not open file " + path); }
+			CSV_Editor::create_csv(file_name);
+			return CSV_View{nullptr, 0};
+		}
+
+		struct stat file_stat{};
+		if (fstat(fd, &file_stat) < 0) {
+			close(fd);
+			throw std::runtime_error("Error: could not open file " + path);
+		}
+		const size_t size = static_cast<size_t>(file_stat.st_size);
+		// mmap does not accept a zero length, an empty file is an empty view.
+		if (size == 0) {
+			close(fd);
+			return CSV_View{nullptr, 0};
+		}
+		void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd); // the mapping stays valid after the descriptor is closed.
+		if (data == MAP_FAILED) { throw std::runtime_error("Error: could not map file " + path); }
+		// the file is read front to back once.
+		madvise(data, size, MADV_SEQUENTIAL);
+		return CSV_View{static_cast<const char*>(data), size};
+	}
+
+	/**
+	 * call func with every non empty row of the file.
+	 * the cells vector is reused between rows, so func must copy what it wants to keep.
+	 * @tparam Func - callable as func(const std::vector<std::string_view>& row).
+	 * @param func - function to call for each row.
+	 */
+	template <typename Func>
+	void for_each_row(Func&& func) const {
+		std::vector<std::string_view> cells{};
+		CSV_Editor::parse_rows(get_data(), true, cells, func);
+	}
+
+	// get the whole mapped file as a view, without the byte order mark at its start (if any).
+	std::string_view get_data() const {
+		return m_data ? CSV_Editor::skip_byte_order_mark({m_data, m_size}) : std::string_view{};
+	}
+};
+
+#endif // CSV_VIEW_H
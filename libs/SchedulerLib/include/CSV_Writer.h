@@ -0,0 +1,193 @@
+#ifndef CSV_WRITER_H
+#define CSV_WRITER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <initializer_list>
+#include <charconv>
+#include <stdexcept>
+#include <cerrno>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "CSV_Editor.h"
+
+// CSV Writer class builds a whole csv file in one contiguous buffer and writes it with a single writev.
+// the file is written to a temporary file that is renamed over the csv file,
+// so a reader (or a crash) sees either the old or the new file, never a partial one.
+// note: writes the same format as CSV_Editor::write_csv (every row ends with a new line).
+class CSV_Writer {
+public:
+	// what a write waits for before it returns.
+	enum class Durability {
+		none, // the data is in the page cache (like CSV_Editor::write_csv).
+		fsync_file, // the data of the file is on disk.
+		fsync_file_and_dir // the data of the file and the rename are on disk.
+	};
+
+	// sync the resources directory, so a rename (or a new file) in it is on disk.
+	static void sync_dir() {
+		const std::string path = CSV_Editor::get_path("");
+		const int fd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd < 0) { throw std::runtime_error("Error: could not open directory " + path); }
+		try { sync(fd, path); }
+		catch (...) {
+			close(fd);
+			throw;
+		}
+		close(fd);
+	}
+
+private:
+	std::string m_buffer{}; // the rows of the file.
+	bool m_in_row{false}; // flag to check if a cell was added to the current row.
+
+	// helper function to sync a file descriptor, throws if the sync fails.
+	static void sync(const int fd, const std::string& path) {
+		if (fsync(fd) < 0) { throw std::runtime_error("Error: could not sync file " + path); }
+	}
+
+	// helper function to write all buffers to the file descriptor, continues after a partial write.
+	static void write_all(const int fd, std::vector<iovec>& buffers, const std::string& path) {
+		size_t first{}; // first buffer that was not fully written.
+		while (first < buffers.size()) {
+			const ssize_t count = writev(fd, buffers.data() + first, static_cast<int>(buffers.size() - first));
+			if (count < 0) {
+				if (errno == EINTR) { continue; }
+				throw std::runtime_error("Error: could not write file " + path);
+			}
+			// skip the written bytes.
+			size_t written = static_cast<size_t>(count);
+			while (first < buffers.size() && written >= buffers[first].iov_len) {
+				written -= buffers[first].iov_len;
+				++first;
+			}
+			if (first < buffers.size()) {
+				buffers[first].iov_base = static_cast<char*>(buffers[first].iov_base) + written;
+				buffers[first].iov_len -= written;
+			}
+		}
+	}
+
+public:
+	// size of a buffer for format_number.
+	static constexpr size_t number_size = 64;
+
+	// format a number like std::to_string into buffer (of number_size chars), without allocating.
+	static std::string_view format_number(const unsigned value, char* buffer) {
+		const auto result = std::to_chars(buffer, buffer + number_size, value);
+		return {buffer, static_cast<size_t>(result.ptr - buffer)};
+	}
+
+	static std::string_view format_number(const float value, char* buffer) {
+		const int size = std::snprintf(buffer, number_size, "%f", static_cast<double>(value));
+		return {buffer, static_cast<size_t>(size)};
+	}
+
+	// add a cell to the current row (see Entity::append_csv).
+	void add_cell(const std::string_view cell) {
+		if (m_in_row) { m_buffer += CSV_Editor::get_delimiter(); }
+		m_in_row = true;
+		m_buffer += cell;
+	}
+
+	void add_cell(const unsigned value) {
+		char buffer[number_size];
+		add_cell(format_number(value, buffer));
+	}
+
+	void add_cell(const float value) {
+		char buffer[number_size];
+		add_cell(format_number(value, buffer));
+	}
+
+	// end the current row.
+	void end_row() {
+		m_buffer += '\n';
+		m_in_row = false;
+	}
+
+	/**
+	 * add a row to the buffer.
+	 * @param row - the cells of the row.
+	 */
+	void add_row(const std::vector<std::string>& row) {
+		for (const std::string& cell : row) { add_cell(cell); }
+		end_row();
+	}
+
+	// reserve bytes in the buffer, for a file with a known size.
+	void reserve(const size_t size) { m_buffer.reserve(size); }
+
+	// clear the buffer (keeps its capacity, so the writer can be reused for the next file).
+	void clear() {
+		m_buffer.clear();
+		m_in_row = false;
+	}
+
+	// get the rows that were added so far.
+	const std::string& get_buffer() const { return m_buffer; }
+
+	/**
+	 * write the buffer to a csv file in the resources directory.
+	 * @param file_name - name of the csv file.
+	 * @param durability - what to wait for before returning.
+	 */
+	void save(const std::string& file_name, const Durability durability = Durability::none) const {
+		write_file(file_name, {m_buffer}, durability);
+	}
+
+	/**
+	 * write csv file with data (vector of rows, each row is a vector of cells).
+	 * if the file exists, it will be replaced else a new file will be created.
+	 * @param file_name - name of the csv file.
+	 * @param data - the rows of the file.
+	 * @param durability - what to wait for before returning.
+	 */
+	static void write_csv(const std::string& file_name, const std::vector<std::vector<std::string>>& data,
+	                      const Durability durability = Durability::none) {
+		CSV_Writer writer{};
+		for (const std::vector<std::string>& row : data) { writer.add_row(row); }
+		writer.save(file_name, durability);
+	}
+
+	/**
+	 * write buffers to a file in the resources directory, through a temporary file that is renamed over it.
+	 * @param file_name - name of the file.
+	 * @param buffers - the contents of the file, written in order with a single writev.
+	 * @param durability - what to wait for before returning.
+	 */
+	static void write_file(const std::string& file_name, const std::initializer_list<std::string_view> buffers,
+	                       const Durability durability = Durability::none) {
+		const std::string path = CSV_Editor::get_path(file_name);
+		const std::string temp_path = path + ".tmp";
+		std::vector<iovec> iovecs{};
+		for (const std::string_view buffer : buffers) {
+			if (!buffer.empty()) { iovecs.push_back({const_cast<char*>(buffer.data()), buffer.size()}); }
+		}
+
+		const int fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (fd < 0) { throw std::runtime_error("Error: could not create file " + temp_path); }
+		try {
+			write_all(fd, iovecs, temp_path);
+			if (durability != Durability::none) { sync(fd, temp_path); }
+		}
+		catch (...) {
+			close(fd);
+			std::remove(temp_path.c_str());
+			throw;
+		}
+		close(fd);
+		if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+			std::remove(temp_path.c_str());
+			throw std::runtime_error("Error: could not rename file " + temp_path);
+		}
+		if (durability == Durability::fsync_file_and_dir) { sync_dir(); }
+	}
+};
+
+#endif // CSV_WRITER_H
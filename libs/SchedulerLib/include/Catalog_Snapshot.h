@@ -0,0 +1,239 @@
+#ifndef CATALOG_SNAPSHOT_H
+#define CATALOG_SNAPSHOT_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+#include <sys/stat.h>
+
+#include "CSV_Editor.h"
+#include "CSV_View.h"
+#include "CSV_Writer.h"
+
+// Catalog Snapshot class represents a single binary file with the rows of all catalog csv files.
+// loading the catalog from the snapshot opens one file instead of three files per course.
+// the csv files stay the interchange format, a section of the snapshot is only used while it is newer than its
+// csv file (so a csv file that was edited by hand is read again).
+// file format (all numbers are little endian):
+// header - magic (8 bytes), number of sections (uint32).
+// offset table - for each section: name length (uint32), name (csv file name), offset (uint64), size (uint64).
+// sections - for each row: number of cells (uint32), then for each cell: length (uint32), bytes.
+class Catalog_Snapshot {
+	// offset and size of a section (the rows of one csv file) in the snapshot.
+	struct Section {
+		uint64_t offset{};
+		uint64_t size{};
+	};
+
+	static constexpr char magic[8] = {'F', 'P', 'S', 'N', 'A', 'P', '0', '1'};
+
+	// the mapped snapshot file (empty if not loaded).
+	CSV_View m_view{};
+	// offset table, keys - csv file names, values - section of the rows in the snapshot.
+	std::unordered_map<std::string, Section> m_sections{};
+	// modification time of the snapshot file.
+	timespec m_time{};
+
+	// helper function to read a number from the mapped file and advance the position.
+	template <typename T>
+	static T read_number(const std::string_view data, size_t& pos) {
+		if (pos + sizeof(T) > data.size()) { throw std::runtime_error("Snapshot is truncated."); }
+		T value{};
+		std::memcpy(&value, data.data() + pos, sizeof(T));
+		pos += sizeof(T);
+		return value;
+	}
+
+	// helper function to append a number to a buffer.
+	template <typename T>
+	static void write_number(std::string& buffer, const T value) {
+		buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	// helper function to get the modification time of a file, returns false if the file does not exist.
+	static bool get_time(const std::string& path, timespec& time) {
+		struct stat file_stat{};
+		if (stat(path.c_str(), &file_stat) != 0) { return false; }
+		time = file_stat.st_mtim;
+		return true;
+	}
+
+public:
+	// get the file name of the snapshot.
+	static std::string get_file_name() { return "catalog.snapshot"; }
+
+	/**
+	 * map the snapshot file and read its offset table.
+	 * @return true if the snapshot was loaded, false if it does not exist or is invalid.
+	 */
+	bool load() {
+		close();
+		try {
+			if (!get_time(CSV_Editor::get_path(get_file_name()), m_time)) { return false; }
+			m_view = CSV_View::map(get_file_name());
+			const std::string_view data = m_view.get_data();
+			if (data.size() < sizeof(magic) || std::memcmp(data.data(), magic, sizeof(magic)) != 0) {
+				throw std::runtime_error("Invalid snapshot header.");
+			}
+			size_t pos{sizeof(magic)};
+			const auto count = read_number<uint32_t>(data, pos);
+			for (uint32_t i = 0; i < count; i++) {
+				const auto name_size = read_number<uint32_t>(data, pos);
+				if (pos + name_size > data.size()) { throw std::runtime_error("Snapshot is truncated."); }
+				std::string name{data.substr(pos, name_size)};
+				pos += name_size;
+				Section section{};
+				section.offset = read_number<uint64_t>(data, pos);
+				section.size = read_number<uint64_t>(data, pos);
+				if (section.offset + section.size > data.size()) { throw std::runtime_error("Snapshot is truncated."); }
+				m_sections[std::move(name)] = section;
+			}
+			return true;
+		}
+		catch (const std::exception& e) {
+			std::cerr << "Error loading snapshot: " << e.what() << std::endl;
+			close();
+			return false;
+		}
+	}
+
+	// unmap the snapshot file.
+	void close() {
+		m_view = CSV_View{};
+		m_sections.clear();
+	}
+
+	/**
+	 * check if the snapshot has an up to date section for a csv file.
+	 * the section is up to date if the snapshot is newer than the csv file (or the csv file does not exist).
+	 * @param file_name - name of the csv file.
+	 * @return true if the rows of the file can be read from the snapshot.
+	 */
+	bool is_fresh(const std::string& file_name) const {
+		if (m_sections.find(file_name) == m_sections.end()) { return false; }
+		timespec csv_time{};
+		if (!get_time(CSV_Editor::get_path(file_name), csv_time)) { return true; }
+		return csv_time.tv_sec < m_time.tv_sec ||
+			(csv_time.tv_sec == m_time.tv_sec && csv_time.tv_nsec <= m_time.tv_nsec);
+	}
+
+	/**
+	 * call func with every row of a csv file section, the cells are views into the mapped snapshot.
+	 * @tparam Func - callable as func(const std::vector<std::string_view>& row).
+	 * @param file_name - name of the csv file.
+	 * @param func - function to call for each row.
+	 */
+	template <typename Func>
+	void for_each_row(const std::string& file_name, Func&& func) const {
+		const auto it = m_sections.find(file_name);
+		if (it == m_sections.end()) { throw std::invalid_argument("File " + file_name + " is not in the snapshot."); }
+		const std::string_view data = m_view.get_data().substr(it->second.offset, it->second.size);
+		std::vector<std::string_view> cells{};
+		size_t pos{};
+		while (pos < data.size()) {
+			cells.clear();
+			const auto cell_count = read_number<uint32_t>(data, pos);
+			for (uint32_t i = 0; i < cell_count; i++) {
+				const auto cell_size = read_number<uint32_t>(data, pos);
+				if (pos + cell_size > data.size()) { throw std::runtime_error("Snapshot is truncated."); }
+				cells.push_back(data.substr(pos, cell_size));
+				pos += cell_size;
+			}
+			func(static_cast<const std::vector<std::string_view>&>(cells));
+		}
+	}
+
+	// Writer class builds a new snapshot in memory and replaces the snapshot file atomically.
+	class Writer {
+		// names and sections of the added files (offsets are relative to the start of the sections).
+		std::vector<std::pair<std::string, Section>> m_table{};
+		std::string m_body{}; // the sections.
+		size_t m_row_offset{}; // offset of the cell count of the current row.
+		uint32_t m_cell_count{}; // number of cells in the current row.
+		bool m_in_row{false}; // flag to check if a cell was added to the current row.
+
+	public:
+		// start the section of a csv file, its rows are added with add_cell and end_row (see Entity::append_csv).
+		void begin_file(const std::string& file_name) { m_table.emplace_back(file_name, Section{m_body.size(), 0}); }
+
+		// end the section of the file started by begin_file.
+		void end_file() { m_table.back().second.size = m_body.size() - m_table.back().second.offset; }
+
+		// add a cell to the current row, numbers are written as text like in the csv file.
+		void add_cell(const std::string_view cell) {
+			if (!m_in_row) {
+				// the cell count is written once the row ends.
+				m_row_offset = m_body.size();
+				write_number(m_body, uint32_t{});
+				m_cell_count = 0;
+				m_in_row = true;
+			}
+			write_number(m_body, static_cast<uint32_t>(cell.size()));
+			m_body += cell;
+			++m_cell_count;
+		}
+
+		void add_cell(const unsigned value) {
+			char buffer[CSV_Writer::number_size];
+			add_cell(CSV_Writer::format_number(value, buffer));
+		}
+
+		void add_cell(const float value) {
+			char buffer[CSV_Writer::number_size];
+			add_cell(CSV_Writer::format_number(value, buffer));
+		}
+
+		// end the current row.
+		void end_row() {
+			if (!m_in_row) {
+				write_number(m_body, uint32_t{}); // a row without cells.
+				return;
+			}
+			std::memcpy(m_body.data() + m_row_offset, &m_cell_count, sizeof(m_cell_count));
+			m_in_row = false;
+		}
+
+		/**
+		 * copy the section of a csv file from another snapshot as is.
+		 * @param file_name - name of the csv file.
+		 * @param snapshot - the loaded snapshot with the section.
+		 */
+		void copy_file(const std::string& file_name, const Catalog_Snapshot& snapshot) {
+			const auto it = snapshot.m_sections.find(file_name);
+			if (it == snapshot.m_sections.end()) {
+				throw std::invalid_argument("File " + file_name + " is not in the snapshot.");
+			}
+			Section section{m_body.size(), it->second.size};
+			m_body += snapshot.m_view.get_data().substr(it->second.offset, it->second.size);
+			m_table.emplace_back(file_name, section);
+		}
+
+		// write the snapshot to a temporary file and rename it over the snapshot file.
+		void save(const CSV_Writer::Durability durability = CSV_Writer::Durability::none) const {
+			std::string header{magic, sizeof(magic)};
+			write_number(header, static_cast<uint32_t>(m_table.size()));
+			// the sections start after the header and the offset table.
+			size_t table_size{};
+			for (const auto& entry : m_table) {
+				table_size += sizeof(uint32_t) + entry.first.size() + 2 * sizeof(uint64_t);
+			}
+			const uint64_t base = header.size() + table_size;
+			for (const auto& [name, section] : m_table) {
+				write_number(header, static_cast<uint32_t>(name.size()));
+				header += name;
+				write_number(header, static_cast<uint64_t>(base + section.offset));
+				write_number(header, section.size);
+			}
+			CSV_Writer::write_file(get_file_name(), {header, m_body}, durability);
+		}
+	};
+};
+
+#endif // CATALOG_SNAPSHOT_H
@@ -0,0 +1,106 @@
+#ifndef CATALOG_VERSION_H
+#define CATALOG_VERSION_H
+
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Entity_Order.h"
+#include "Version_List.h"
+#include "data/Course.h"
+#include "data/Entity.h"
+#include "data/Student.h"
+#include "data/Teacher.h"
+
+/**
+ * Catalog Version class is an immutable version of the students, teachers and courses of the catalog.
+ * a reader pins a version (see Entity_Manager::pin_version()) and reads it without locking the catalog,
+ * while a write command makes the next version and publishes it once it is done,
+ * so a reader never waits for a writer and never sees a change that is half done (like a course without its labs).
+ * the versions share the unchanged parts of their lists (see Version_List), and the entities themselves:
+ * a published entity is not changed, a course whose course types change is replaced by a copy.
+ * a removed entity is deleted with the garbage of the last version that has it, once no reader pins that version.
+ */
+class Catalog_Version {
+public:
+	/*the entities that were removed from the catalog after a version was published.
+	every version has the garbage of the changes after it, which has the garbage of the next version and so on,
+	so a pinned version keeps the entities it has alive, and the garbage is deleted with the last version before it.*/
+	struct Garbage {
+		std::vector<Entity*> entities{};
+		// courses that were replaced by a copy, the copy owns their course types (see Course::share_course_types()).
+		std::vector<Course*> replaced_courses{};
+		std::shared_ptr<Garbage> next{}; // garbage of the next version.
+
+		Garbage() = default;
+		// no copy since the garbage owns the entities.
+		Garbage(const Garbage&) = delete;
+		Garbage& operator=(const Garbage&) = delete;
+
+		~Garbage() {
+			for (Entity* entity : entities) { delete entity; }
+			for (Course* course : replaced_courses) {
+				course->release_course_types();
+				delete course;
+			}
+			// delete the garbage of the next versions that are not pinned one after another,
+			// a recursive destruction of a long chain could overflow the stack.
+			std::shared_ptr<Garbage> garbage{std::move(next)};
+			while (garbage && garbage.use_count() == 1) { garbage = std::move(garbage->next); }
+		}
+	};
+
+private:
+	friend class Entity_Manager; // makes and publishes the versions.
+
+	Version_List<Student> m_students{};
+	Version_List<Teacher> m_teachers{};
+	Version_List<Course> m_courses{};
+	std::shared_ptr<Garbage> m_garbage{}; // garbage of the changes after this version.
+
+	// get the list of main type T (Student, Teacher, Course), to make the next version.
+	template <typename T>
+	Version_List<T>& get_list() {
+		if constexpr (std::is_same_v<T, Student>) { return m_students; }
+		else if constexpr (std::is_same_v<T, Teacher>) { return m_teachers; }
+		else { return m_courses; }
+	}
+
+public:
+	/**
+	 * get the entities of main type T of the version, in the order of the entity type.
+	 * @tparam T - type of entity (Student, Teacher, Course).
+	 * @return the entities, valid while the version is pinned.
+	 */
+	template <typename T>
+	const Version_List<T>& get_entities() const { return const_cast<Catalog_Version*>(this)->get_list<T>(); }
+
+	/**
+	 * print a page of the entities of main type T, starting at a cursor (see Entity_Order::Cursor).
+	 * a page takes O(log n + count) however deep it is, and the cursor is valid in the next versions too.
+	 * @tparam T - type of entity (Student, Teacher, Course).
+	 * @param cursor - where the page starts (a default cursor for the first page), moved to after the page.
+	 * @param count - maximum number of entities to print.
+	 * @return number of entities printed (0 when there are no entities after the cursor).
+	 */
+	template <typename T>
+	size_t print_page(Entity_Order::Cursor& cursor, const size_t count) const {
+		const Version_List<T>& entities = get_entities<T>();
+		size_t printed{};
+		for (auto it = entities.seek(cursor); it != entities.end() && printed < count; ++it, ++printed) {
+			std::cout << *it->entity << std::endl; // print the entity.
+			cursor = it->cursor.next(); // continue after the printed entity.
+		}
+		return printed;
+	}
+
+	// print all entities of main type T in the order of the entity type.
+	template <typename T>
+	void print_entities() const {
+		for (const auto& item : get_entities<T>()) { std::cout << *item.entity << std::endl; }
+	}
+};
+
+#endif // CATALOG_VERSION_H
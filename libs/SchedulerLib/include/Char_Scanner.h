@@ -0,0 +1,120 @@
+#ifndef CHAR_SCANNER_H
+#define CHAR_SCANNER_H
+
+#include <cstdint>
+#include <string_view>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CHAR_SCANNER_X86
+#include <immintrin.h>
+#endif
+
+// Char Scanner is a static utility class to find the positions of one or two characters in a buffer.
+// used to find the delimiters and line breaks of csv data, and the spaces of a command line.
+// on x86 it compares 32 bytes (AVX2) or 16 bytes (SSE2) at a time, the instruction set is picked at runtime.
+// other platforms (and the tail of the buffer) use a scalar loop.
+class Char_Scanner {
+	// private constructor and destructor to prevent instantiation.
+	Char_Scanner() = default;
+	~Char_Scanner() = default;
+
+	// scalar loop from pos to the end of data.
+	template <typename Func>
+	static void scan_scalar(const std::string_view data, size_t pos, const char first, const char second, Func& func) {
+		for (; pos < data.size(); pos++) {
+			if (data[pos] == first || data[pos] == second) { func(pos); }
+		}
+	}
+
+#ifdef CHAR_SCANNER_X86
+	// call func for each set bit of mask (the matches of a block that starts at base), in order.
+	template <typename Func>
+	static void for_each_bit(uint32_t mask, const size_t base, Func& func) {
+		while (mask != 0) {
+			func(base + static_cast<size_t>(__builtin_ctz(mask)));
+			mask &= mask - 1; // clear the lowest set bit.
+		}
+	}
+
+	template <typename Func>
+	__attribute__((target("sse2")))
+	static void scan_sse2(const std::string_view data, const char first, const char second, Func& func) {
+		const __m128i first_block = _mm_set1_epi8(first);
+		const __m128i second_block = _mm_set1_epi8(second);
+		size_t pos{};
+		for (; pos + 16 <= data.size(); pos += 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + pos));
+			const __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, first_block),
+			                                     _mm_cmpeq_epi8(block, second_block));
+			for_each_bit(static_cast<uint32_t>(_mm_movemask_epi8(matches)), pos, func);
+		}
+		scan_scalar(data, pos, first, second, func);
+	}
+
+	template <typename Func>
+	__attribute__((target("avx2")))
+	static void scan_avx2(const std::string_view data, const char first, const char second, Func& func) {
+		const __m256i first_block = _mm256_set1_epi8(first);
+		const __m256i second_block = _mm256_set1_epi8(second);
+		size_t pos{};
+		for (; pos + 32 <= data.size(); pos += 32) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos));
+			const __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, first_block),
+			                                        _mm256_cmpeq_epi8(block, second_block));
+			for_each_bit(static_cast<uint32_t>(_mm256_movemask_epi8(matches)), pos, func);
+		}
+		scan_scalar(data, pos, first, second, func);
+	}
+
+	// check once if the cpu supports AVX2 (SSE2 is always there on x86-64).
+	static bool has_avx2() {
+		static const bool supported = __builtin_cpu_supports("avx2");
+		return supported;
+	}
+
+	static bool has_sse2() {
+		static const bool supported = __builtin_cpu_supports("sse2");
+		return supported;
+	}
+#endif
+
+public:
+	/**
+	 * call func with the position of every character of data that is first or second, in order.
+	 * a single pass over data, so the matches of a whole buffer are found at once.
+	 * @tparam Func - callable as func(size_t pos).
+	 * @param data - the buffer to scan.
+	 * @param first - character to find.
+	 * @param second - another character to find (same as first to find a single character).
+	 * @param func - function to call for each match.
+	 */
+	template <typename Func>
+	static void for_each_match(const std::string_view data, const char first, const char second, Func&& func) {
+#ifdef CHAR_SCANNER_X86
+		if (has_avx2()) {
+			scan_avx2(data, first, second, func);
+			return;
+		}
+		if (has_sse2()) {
+			scan_sse2(data, first, second, func);
+			return;
+		}
+#endif
+		scan_scalar(data, 0, first, second, func);
+	}
+
+	/**
+	 * same as for_each_match, with the scalar loop on every platform (the reference for the benchmarks).
+	 * @tparam Func - callable as func(size_t pos).
+	 * @param data - the buffer to scan.
+	 * @param first - character to find.
+	 * @param second - another character to find (same as first to find a single character).
+	 * @param func - function to call for each match.
+	 */
+	template <typename Func>
+	static void for_each_match_scalar(const std::string_view data, const char first, const char second, Func&& func) {
+		scan_scalar(data, 0, first, second, func);
+	}
+};
+
+#endif // CHAR_SCANNER_H
@@ -0,0 +1,146 @@
+#ifndef COURSE_TYPE_INDEX_H
+#define COURSE_TYPE_INDEX_H
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "data/Course.h"
+#include "data/course_types/Course_Type.h"
+
+/**
+ * Course Type Index class keeps secondary indexes over the course types (Lecture, Tutorial, Lab) of all courses,
+ * by day, classroom, lecturer name and start hour.
+ * a query looks at the course types of its most selective field only, instead of the course types of every course.
+ * note: the index refers to the course types, they must be removed from the index before they are deleted.
+ */
+class Course_Type_Index {
+public:
+	// a query for course types, the empty (or negative) fields match any course type.
+	struct Query {
+		std::string day{};
+		std::string classroom{};
+		std::string lecturer{};
+		int start_hour{-1}; // hour the course type starts at (0 - 23), -1 for any hour.
+	};
+
+	// a course type that matches a query, with its course.
+	struct Match {
+		const Course* course{};
+		const Course_Type* course_type{};
+	};
+
+	static constexpr int hours = 24;
+
+private:
+	// course types of a value of a field, keys - course types, values - their courses.
+	using Posting = std::unordered_map<const Course_Type*, const Course*>;
+
+	std::unordered_map<std::string, Posting> m_days{};
+	std::unordered_map<std::string, Posting> m_classrooms{};
+	std::unordered_map<std::string, Posting> m_lecturers{};
+	std::array<Posting, hours> m_start_hours{};
+	size_t m_size{}; // number of indexed course types.
+
+	// helper function to get the posting of the start hour of a course type.
+	Posting& get_hour_posting(const Course_Type& course_type) {
+		return m_start_hours[static_cast<size_t>(std::clamp(course_type.get_start_hour(), 0, hours - 1))];
+	}
+
+	// helper function to remove a course type from the posting of a value (and the posting once it is empty).
+	static void erase(std::unordered_map<std::string, Posting>& postings, const std::string_view value,
+	                  const Course_Type* course_type) {
+		const auto it = postings.find(std::string{value});
+		if (it == postings.end()) { return; }
+		it->second.erase(course_type);
+		if (it->second.empty()) { postings.erase(it); }
+	}
+
+	// helper function to get the posting of a value of a field, nullptr if no course type has the value.
+	static const Posting* find_posting(const std::unordered_map<std::string, Posting>& postings,
+	                                   const std::string& value) {
+		const auto it = postings.find(value);
+		return it != postings.end() ? &it->second : nullptr;
+	}
+
+	// helper function to check if a course type matches all fields of a query.
+	static bool matches(const Course_Type& course_type, const Query& query) {
+		return (query.day.empty() || course_type.get_day_view() == query.day) &&
+			(query.classroom.empty() || course_type.get_classroom_view() == query.classroom) &&
+			(query.lecturer.empty() || course_type.get_name_view() == query.lecturer) &&
+			(query.start_hour < 0 || course_type.get_start_hour() == query.start_hour);
+	}
+
+public:
+	// get the number of indexed course types.
+	size_t size() const { return m_size; }
+
+	// add a course type of a course to the index.
+	void add(const Course* course, const Course_Type* course_type) {
+		if (!m_days[std::string{course_type->get_day_view()}].emplace(course_type, course).second) { return; }
+		m_classrooms[std::string{course_type->get_classroom_view()}].emplace(course_type, course);
+		m_lecturers[std::string{course_type->get_name_view()}].emplace(course_type, course);
+		get_hour_posting(*course_type).emplace(course_type, course);
+		++m_size;
+	}
+
+	// remove a course type from the index (before it is deleted).
+	void remove(const Course_Type* course_type) {
+		if (!course_type) { return; }
+		const auto it = m_days.find(std::string{course_type->get_day_view()});
+		if (it == m_days.end() || it->second.count(course_type) == 0) { return; }
+		erase(m_days, course_type->get_day_view(), course_type);
+		erase(m_classrooms, course_type->get_classroom_view(), course_type);
+		erase(m_lecturers, course_type->get_name_view(), course_type);
+		get_hour_posting(*course_type).erase(course_type);
+		--m_size;
+	}
+
+	// remove all course types from the index.
+	void clear() {
+		m_days.clear();
+		m_classrooms.clear();
+		m_lecturers.clear();
+		for (Posting& posting : m_start_hours) { posting.clear(); }
+		m_size = 0;
+	}
+
+	/**
+	 * find the course types that match a query.
+	 * the course types of the field with the fewest course types are checked against the other fields.
+	 * @param query - the fields to match (at least one field should be set, else no course type matches).
+	 * @return the matches, sorted by course id and group id.
+	 */
+	std::vector<Match> find(const Query& query) const {
+		std::vector<Match> result{};
+		std::vector<const Posting*> candidates{};
+		if (!query.day.empty()) { candidates.push_back(find_posting(m_days, query.day)); }
+		if (!query.classroom.empty()) { candidates.push_back(find_posting(m_classrooms, query.classroom)); }
+		if (!query.lecturer.empty()) { candidates.push_back(find_posting(m_lecturers, query.lecturer)); }
+		if (query.start_hour >= hours) { return result; }
+		if (query.start_hour >= 0) { candidates.push_back(&m_start_hours[static_cast<size_t>(query.start_hour)]); }
+		// a query without fields, or with a value that no course type has, matches nothing.
+		if (candidates.empty() || std::find(candidates.begin(), candidates.end(), nullptr) != candidates.end()) {
+			return result;
+		}
+		const Posting* smallest = *std::min_element(candidates.begin(), candidates.end(),
+		                                            [](const Posting* first, const Posting* second) {
+			                                            return first->size() < second->size();
+		                                            });
+		for (const auto& [course_type, course] : *smallest) {
+			if (matches(*course_type, query)) { result.push_back({course, course_type}); }
+		}
+		std::sort(result.begin(), result.end(), [](const Match& first, const Match& second) {
+			if (first.course != second.course) {
+				return first.course->get_id_view() < second.course->get_id_view();
+			}
+			return first.course_type->get_id_view() < second.course_type->get_id_view();
+		});
+		return result;
+	}
+};
+
+#endif // COURSE_TYPE_INDEX_H
@@ -3,12 +3,35 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
 #include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
 
 #include "CSV_Editor.h"
+#include "CSV_View.h"
+#include "CSV_Writer.h"
+#include "Entity_Order.h"
+#include "Entity_Store.h"
+#include "Catalog_Snapshot.h"
+#include "Catalog_Version.h"
+#include "Course_Type_Index.h"
+#include "Journal.h"
+#include "Prefix_Index.h"
+#include "Search_Index.h"
+#include "Thread_Pool.h"
 #include "data/Course.h"
 #include "data/Entity.h"
+#include "data/Student.h"
+#include "data/Teacher.h"
 #include "data/course_types/Lecture.h"
 #include "data/course_types/Tutorial.h"
 #include "data/course_types/Lab.h"
@@ -18,13 +41,104 @@
 // Entity_Manager class represents a signel instance class to manage entities.
 // it manages entities of main types (Student, Teacher, Course) and sub types (Lecture, Tutorial, Lab).
 class Entity_Manager {
-	/*map to store entities of main types (Student, Teacher, Course).
-	keys - entity ids, values - pointers to entities.*/
-	std::unordered_map<std::string, Entity*> m_entities{};
+	/*stores of the entities of main types (Student, Teacher, Course), one per type.
+	typed lookup by id without a cast, and ids only have to be unique within a type (see Entity_Store).
+	note: the course types (Lecture, Tutorial, Lab) are kept by their course.*/
+	Entity_Store<Student> m_students{};
+	Entity_Store<Teacher> m_teachers{};
+	Entity_Store<Course> m_courses{};
+
+	/*inverted indexes of the searchable cells of the main types, one per type (see search_entites()).
+	built on the first search, then kept up to date by add_entity_to_collections and remove_entity_from_collections.*/
+	Search_Index<Student> m_student_index{};
+	Search_Index<Teacher> m_teacher_index{};
+	Search_Index<Course> m_course_index{};
+	bool m_search_index_built{false};
+	// sorted ids, names and lecturer names of the courses, built on the first completion (see complete()).
+	Prefix_Index m_prefix_index{};
+	bool m_prefix_index_built{false};
+	// course types of all courses by day, classroom, lecturer and start hour, built on the first query.
+	Course_Type_Index m_course_type_index{};
+	bool m_course_type_index_built{false};
 	/*map to store order of entities of all types (Student, Teacher, Course, Lecture, Tutorial, Lab).
 	to keep read and write order of all csv files.
-	keys - file names, values - vector of ids in order.*/
-	std::unordered_map<std::string, std::vector<std::string>> m_entity_order{};
+	keys - file names, values - ids in order (with O(1) add, remove and lookup, see Entity_Order).*/
+	std::unordered_map<std::string, Entity_Order> m_entity_order{};
+	/*set of file names (keys of m_entity_order) that were modified since they were last written.
+	only these files are rewritten by write_entities (on checkpoint and in the destructor).*/
+	std::unordered_set<std::string> m_dirty_files{};
+
+	// write ahead journal of add and remove mutations, replayed on startup (see recover()).
+	Journal m_journal{};
+	// number of journal records that starts a compaction of the journal into the csv files.
+	static constexpr size_t compaction_threshold = 10000;
+	/*background compaction that writes the csv files (see compact()).
+	note: declared after m_journal so it is waited for before the journal is destroyed.*/
+	std::future<void> m_compaction{};
+	// flag to check if the journal is being replayed (replayed mutations are not journaled again).
+	bool m_replaying{false};
+
+	// binary snapshot of all csv files, preferred over a csv file while it is newer (see read_entities).
+	Catalog_Snapshot m_snapshot{};
+	// flag to check if the snapshot was loaded (it is mapped on the first read).
+	bool m_snapshot_checked{false};
+	// flag to check if the catalog changed since the snapshot was written (or a file was read from csv).
+	bool m_snapshot_stale{false};
+
+	// what a write of a csv file, the snapshot or a journal record waits for, see set_durability().
+	inline static CSV_Writer::Durability durability{CSV_Writer::Durability::none};
+	// buffer of the csv file that is being written, reused so its memory is allocated once per checkpoint.
+	CSV_Writer m_writer{};
+
+	/*lock of the catalog, so sessions on several threads can share the manager (see read_lock() and write_lock()).
+	note: the manager does not take it by itself, a session holds it for a whole command,
+	so the entities the command gets stay valid until it is done with them.*/
+	mutable std::shared_mutex m_mutex{};
+	/*flag to check if prepare_concurrent_reads() loaded what the reads would load on first use,
+	until then read_lock() locks the catalog exclusively (see Read_Lock).*/
+	std::atomic<bool> m_concurrent_reads_prepared{false};
+
+	/*the published version of the main types, pinned by readers that do not lock the catalog (see pin_version()).
+	built on the first pin, then replaced by the version a write command made when its lock is released.
+	note: read and replaced with std::atomic_load and std::atomic_store while readers pin it.*/
+	std::shared_ptr<const Catalog_Version> m_version{};
+	// the next version, a copy of m_version made by the first change of a write command (see get_draft()).
+	std::shared_ptr<Catalog_Version> m_draft{};
+	// garbage of the changes after m_version (nullptr until the first version is built), see retire().
+	std::shared_ptr<Catalog_Version::Garbage> m_garbage{};
+	// courses of m_version that the write command copied, keys - the published courses, values - the copies.
+	std::unordered_map<const Course*, Course*> m_course_copies{};
+	// courses that no version has yet (copies and new courses), the write command changes them in place.
+	std::unordered_set<const Course*> m_unpublished_courses{};
+
+	// flag to check if the course types loader was set (see process_course()).
+	bool m_course_types_loader_set{false};
+
+	// entities of one file (or of a chunk of a large file) parsed on the thread pool, merged by read_entities.
+	struct Parsed_File {
+		std::vector<Entity*> entities{};
+		std::string error{}; // error that stopped the parsing (the entities parsed before it are kept).
+		bool from_snapshot{false};
+	};
+
+	/*flag to parse independent files concurrently on the thread pool (see start_parallel_load()).
+	the results are merged in the same order as a sequential load, so the files are written back in the same order.*/
+	inline static bool parallel_load{true};
+	/*worker threads that parse the files.
+	note: declared after m_snapshot so the workers are stopped before the snapshot is unmapped.*/
+	Thread_Pool m_pool{};
+	/*files that are parsed on the thread pool and not merged yet.
+	keys - file names, values - the parsed chunks of the file in file order (a single chunk unless it is large).*/
+	std::unordered_map<std::string, std::vector<std::future<Parsed_File>>> m_pending_files{};
+	// size of a chunk of a large csv file, the file is parsed by up to one worker per chunk (see submit_chunks()).
+	static constexpr size_t parallel_chunk_size = 1024 * 1024;
+	// flag to check if the main type files were submitted to the thread pool.
+	bool m_parallel_load_started{false};
+
+	// main types have a store in the manager, course types are kept by their course.
+	template <typename T>
+	static constexpr bool is_main_type =
+		std::is_same_v<T, Student> || std::is_same_v<T, Teacher> || std::is_same_v<T, Course>;
 
 	/*private constructor and destructor to prevent object creation (single instance class).
 	constructor to read entities from csv files.
@@ -34,8 +148,190 @@ class Entity_Manager {
 	Entity_Manager();
 	~Entity_Manager();
 
-	// clean up function to delete all entities and order maps.
-	void clean_up();
+	// delete all entities and clear the order maps and indexes (on destruction).
+	void delete_entities() {
+		for (Student* student : m_students) { delete student; }
+		for (Teacher* teacher : m_teachers) { delete teacher; }
+		for (Course* course : m_courses) { delete course; }
+		m_students.clear();
+		m_teachers.clear();
+		m_courses.clear();
+		m_entity_order.clear();
+		m_student_index.clear();
+		m_teacher_index.clear();
+		m_course_index.clear();
+		m_search_index_built = false;
+		m_prefix_index.clear();
+		m_prefix_index_built = false;
+		m_course_type_index.clear();
+		m_course_type_index_built = false;
+		m_draft.reset();
+		m_course_copies.clear();
+		m_unpublished_courses.clear();
+		std::atomic_store(&m_version, std::shared_ptr<const Catalog_Version>{});
+		m_garbage.reset(); // deletes the removed entities.
+		m_concurrent_reads_prepared.store(false, std::memory_order_release);
+	}
+
+	// get the store of main type T (Student, Teacher, Course).
+	template <typename T>
+	Entity_Store<T>& get_store() {
+		static_assert(is_main_type<T>, "Only main types (Student, Teacher, Course) have a store.");
+		if constexpr (std::is_same_v<T, Student>) { return m_students; }
+		else if constexpr (std::is_same_v<T, Teacher>) { return m_teachers; }
+		else { return m_courses; }
+	}
+
+	template <typename T>
+	const Entity_Store<T>& get_store() const { return const_cast<Entity_Manager*>(this)->get_store<T>(); }
+
+	// get the search index of main type T (Student, Teacher, Course).
+	template <typename T>
+	Search_Index<T>& get_search_index() {
+		static_assert(is_main_type<T>, "Only main types (Student, Teacher, Course) have a search index.");
+		if constexpr (std::is_same_v<T, Student>) { return m_student_index; }
+		else if constexpr (std::is_same_v<T, Teacher>) { return m_teacher_index; }
+		else { return m_course_index; }
+	}
+
+	// build the search indexes of all main types on the first search.
+	// the course types of all courses are loaded, since a course is searched with its course types.
+	void build_search_index() {
+		if (m_search_index_built) { return; }
+		prefetch_all_course_types();
+		for (const Student* student : m_students) { m_student_index.add(student); }
+		for (const Teacher* teacher : m_teachers) { m_teacher_index.add(teacher); }
+		for (const Course* course : m_courses) { m_course_index.add(course); }
+		m_search_index_built = true;
+	}
+
+	// build the prefix index of the courses on the first completion.
+	void build_prefix_index() {
+		if (m_prefix_index_built) { return; }
+		for (const Course* course : m_courses) { m_prefix_index.add(*course); }
+		m_prefix_index_built = true;
+	}
+
+	// build the course type index on the first query, the course types of all courses are loaded.
+	void build_course_type_index() {
+		if (m_course_type_index_built) { return; }
+		prefetch_all_course_types();
+		for (const Course* course : m_courses) {
+			course->for_each_course_type([&](const Course_Type& course_type) {
+				m_course_type_index.add(course, &course_type);
+			});
+		}
+		m_course_type_index_built = true;
+	}
+
+	// build the first version from the catalog, if it was not built yet.
+	// note: the course types that are not loaded yet are loaded into the published courses on first access,
+	// so prepare_concurrent_reads() loads them before the readers run on several threads.
+	void build_version() {
+		if (m_garbage) { return; }
+		const std::shared_ptr<Catalog_Version> version{std::make_shared<Catalog_Version>()};
+		add_to_version<Student>(*version);
+		add_to_version<Teacher>(*version);
+		add_to_version<Course>(*version);
+		m_garbage = std::make_shared<Catalog_Version::Garbage>();
+		version->m_garbage = m_garbage;
+		std::atomic_store(&m_version, std::shared_ptr<const Catalog_Version>{version});
+	}
+
+	// helper function to add the entities of main type T to a version, in order.
+	template <typename T>
+	void add_to_version(Catalog_Version& version) const {
+		const auto it = m_entity_order.find(T::get_file_name());
+		if (it == m_entity_order.end()) { return; }
+		const Entity_Order& order = it->second;
+		for (auto id = order.begin(); id != order.end(); ++id) {
+			version.get_list<T>().push_back(order.get_cursor(id), get_entity<T>(*id));
+		}
+	}
+
+	// get the next version, the published version is copied (its lists share their chunks) on the first change.
+	Catalog_Version& get_draft() {
+		if (!m_draft) { m_draft = std::make_shared<Catalog_Version>(*m_version); }
+		return *m_draft;
+	}
+
+	// publish the version the write command made (see Write_Lock), the readers pin it from now on.
+	void publish_version() {
+		if (!m_draft) { return; }
+		// the entities removed from now on are in the new version, so they go to its garbage.
+		m_draft->m_garbage = std::make_shared<Catalog_Version::Garbage>();
+		m_garbage->next = m_draft->m_garbage;
+		m_garbage = m_draft->m_garbage;
+		std::atomic_store(&m_version, std::shared_ptr<const Catalog_Version>{std::move(m_draft)});
+		m_draft.reset();
+		m_course_copies.clear();
+		m_unpublished_courses.clear();
+	}
+
+	/**
+	 * delete an entity that was removed from the catalog.
+	 * while there are versions, the published version may still have it,
+	 * so it is kept in the garbage until no reader pins a version that has it.
+	 * @param entity - the removed entity.
+	 */
+	void retire(Entity* entity) {
+		if (!m_garbage) {
+			delete entity;
+			return;
+		}
+		m_garbage->entities.push_back(entity);
+	}
+
+	/**
+	 * get the course a write command can change the course types of.
+	 * a course of the published version is not changed, since readers may be printing it:
+	 * it is copied once per command (with the same course types) and the copy replaces it in the catalog.
+	 * @param course - the course to change (the published course or its copy).
+	 * @return the course to change.
+	 */
+	Course* get_writable_course(Course* course) {
+		if (!m_garbage || m_unpublished_courses.count(course) > 0) { return course; }
+		const auto it = m_course_copies.find(course);
+		if (it != m_course_copies.end()) { return it->second; }
+		// a course that is not in the catalog (it is being removed) is not copied.
+		if (m_courses.get(course->get_id_view()) != course) { return course; }
+		Course* copy = course->share_course_types();
+		m_courses.replace(copy);
+		const Entity_Order& order = m_entity_order[Course::get_file_name()];
+		get_draft().get_list<Course>().replace(order.find_cursor(copy->get_id_view()), copy);
+		if (m_search_index_built) { m_course_index.update(copy); }
+		if (m_course_type_index_built) {
+			copy->for_each_course_type([this, copy](const Course_Type& course_type) {
+				m_course_type_index.remove(&course_type);
+				m_course_type_index.add(copy, &course_type);
+			});
+		}
+		// the published course is deleted once no reader pins a version that has it.
+		m_garbage->replaced_courses.push_back(course);
+		m_course_copies.emplace(course, copy);
+		m_unpublished_courses.insert(copy);
+		return copy;
+	}
+
+	/**
+	 * helper function to get entity of type T by id.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param id - id of the entity.
+	 * @param course - pointer to the course of course types (not used for main types).
+	 * @return pointer to the entity if found, nullptr otherwise.
+	 */
+	template <typename T>
+	T* find_entity(const std::string_view id, const Course* course = nullptr) const {
+		if constexpr (is_main_type<T>) { return get_entity<T>(id); }
+		else { return course ? Entity::cast<T>(course->get_course_type(id)) : nullptr; }
+	}
+
+	// helper function to get entity of type T by the handle of its id (see find_entity(id)).
+	template <typename T>
+	T* find_entity(const Symbol_Table::Handle handle, const Course* course = nullptr) const {
+		if constexpr (is_main_type<T>) { return get_store<T>().get(handle); }
+		else { return course ? Entity::cast<T>(course->get_course_type(handle)) : nullptr; }
+	}
 
 	/**
 	 * read entities of type T from csv file into m_entities and m_entity_order maps.
@@ -47,42 +343,295 @@ class Entity_Manager {
 	void read_entities(Course* course = nullptr) {
 		// get the file name for the entity type.
 		const std::string file_name = get_file_name<T>(course);
+		// the first read of a main type starts parsing the files of all main types on the thread pool.
+		if (!course) { start_parallel_load(); }
+		// a file that was parsed on the thread pool is merged instead of read again.
+		if (merge_parsed_file<T>(file_name, course)) { return; }
+		// prefer the snapshot, it has the rows of all files in one mapped file.
+		if (read_from_snapshot<T>(file_name, course)) { return; }
+		// the file is read from csv, so the snapshot is not up to date with it.
+		m_snapshot_stale = true;
 		try {
-			// read data from csv file.
-			std::vector<std::vector<std::string>> data = CSV_Editor::read_csv(file_name);
-			for (std::vector<std::string>& row : data) {
+			// stream the csv file, only one chunk of the file is held in memory at a time.
+			CSV_Editor::stream_csv(file_name, [&](const std::vector<std::string_view>& row) {
 				// process entity from csv row and add to m_entities and m_entity_order maps.
 				process_entity<T>(file_name, row, course);
-			}
-			data.clear(); // clear the data vector.
+			});
 		}
 		catch (const std::exception& e) {
 			// log the error and throw the exception again.
 			std::cerr << "Error reading file: " << file_name << ": " << e.what() << std::endl;
+			// the file is missing or invalid, so it is written again on the next checkpoint.
+			mark_dirty(file_name);
+		}
+	}
+
+	/**
+	 * read entities of type T from the snapshot, if it has an up to date section for the file.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param file_name - name of the csv file.
+	 * @param course - optional pointer to course object to read course types.
+	 * @return true if the file was read from the snapshot, false if it has to be read from csv.
+	 */
+	template <typename T>
+	bool read_from_snapshot(const std::string& file_name, Course* course = nullptr) {
+		check_snapshot();
+		if (!m_snapshot.is_fresh(file_name)) { return false; }
+		try {
+			m_snapshot.for_each_row(file_name, [&](const std::vector<std::string_view>& row) {
+				// process entity from snapshot row and add to m_entities and m_entity_order maps.
+				process_entity<T>(file_name, row, course);
+			});
+		}
+		catch (const std::exception& e) {
+			// same as a csv read error, the rows read so far are kept and the file is written again.
+			std::cerr << "Error reading snapshot: " << file_name << ": " << e.what() << std::endl;
+			mark_dirty(file_name);
+		}
+		return true;
+	}
+
+	// map the snapshot on the first read.
+	void check_snapshot() {
+		if (m_snapshot_checked) { return; }
+		m_snapshot_checked = true;
+		m_snapshot.load();
+	}
+
+	// check if files are parsed on the thread pool (not worth it with a single worker).
+	bool is_parallel_load() const { return parallel_load && m_pool.get_size() > 1; }
+
+	// submit the files of all main types (Student, Teacher, Course) to the thread pool, once.
+	void start_parallel_load() {
+		if (m_parallel_load_started || !is_parallel_load()) { return; }
+		m_parallel_load_started = true;
+		// the snapshot is mapped here, the workers only read it.
+		check_snapshot();
+		submit_file<Student>();
+		submit_file<Teacher>();
+		submit_file<Course>();
+	}
+
+	/**
+	 * helper function to parse the file of type T on the thread pool (if it is not parsed already).
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param course - optional pointer to course object to parse course types.
+	 */
+	template <typename T>
+	void submit_file(const Course* course = nullptr) {
+		const std::string file_name = get_file_name<T>(course);
+		if (m_pending_files.find(file_name) != m_pending_files.end()) { return; }
+		std::vector<std::future<Parsed_File>>& pending = m_pending_files[file_name];
+		// a large csv file of a main type is split into chunks that are parsed in parallel.
+		if (!course && !m_snapshot.is_fresh(file_name) && submit_chunks<T>(file_name, pending)) { return; }
+		pending.push_back(m_pool.submit([this, file_name] { return parse_file<T>(file_name); }));
+	}
+
+	/**
+	 * helper function to split a large csv file of type T at row boundaries and parse the chunks on the thread pool.
+	 * @tparam T - type of entity (Student, Teacher, Course).
+	 * @param file_name - name of the csv file.
+	 * @param pending - vector to add the parsed chunks to, in file order.
+	 * @return true if the chunks were submitted, false if the file is small (or can not be mapped).
+	 */
+	template <typename T>
+	bool submit_chunks(const std::string& file_name, std::vector<std::future<Parsed_File>>& pending) {
+		// the mapping is shared by the chunks, it is unmapped once the last chunk was parsed.
+		std::shared_ptr<const CSV_View> view{};
+		try { view = std::make_shared<const CSV_View>(CSV_View::map(file_name)); }
+		catch (const std::exception&) { return false; } // parse_file reports the error.
+		const size_t chunk_count = std::min(m_pool.get_size(), view->get_data().size() / parallel_chunk_size);
+		if (chunk_count < 2) { return false; }
+		for (const std::string_view chunk : CSV_Editor::split_chunks(view->get_data(), chunk_count)) {
+			pending.push_back(m_pool.submit([view, chunk] {
+				Parsed_File parsed{};
+				std::vector<std::string_view> cells{};
+				auto on_row = [&parsed](const std::vector<std::string_view>& row) { add_parsed_row<T>(parsed, row); };
+				try { CSV_Editor::parse_rows(chunk, true, cells, on_row); }
+				catch (const std::exception& e) { parsed.error = e.what(); }
+				return parsed;
+			}));
+		}
+		return true;
+	}
+
+	/*helper function to create the entity of a row of type T on a worker thread.
+	note: students read their own schedule file and number their own schedules, so they are created here too.*/
+	template <typename T>
+	static void add_parsed_row(Parsed_File& parsed, const std::vector<std::string_view>& row) {
+		parsed.entities.push_back(T::from_csv(row));
+	}
+
+	/**
+	 * parse the file of type T from the snapshot or the csv file, runs on a worker thread.
+	 * only reads the snapshot and the file, the maps are changed by merge_parsed_file on the reading thread.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param file_name - name of the csv file.
+	 * @return the parsed entities of the file.
+	 */
+	template <typename T>
+	Parsed_File parse_file(const std::string& file_name) const {
+		Parsed_File parsed{};
+		auto on_row = [&parsed](const std::vector<std::string_view>& row) { add_parsed_row<T>(parsed, row); };
+		try {
+			parsed.from_snapshot = m_snapshot.is_fresh(file_name);
+			if (parsed.from_snapshot) { m_snapshot.for_each_row(file_name, on_row); }
+			else { CSV_Editor::stream_csv(file_name, on_row); }
+		}
+		catch (const std::exception& e) { parsed.error = e.what(); }
+		return parsed;
+	}
+
+	/**
+	 * merge the file of type T that was parsed on the thread pool into m_entities and m_entity_order maps.
+	 * waits for the chunks of the file that are still being parsed, and merges them in file order.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param file_name - name of the csv file.
+	 * @param course - optional pointer to course object to merge course types.
+	 * @return true if the file was merged, false if it was not submitted to the thread pool.
+	 */
+	template <typename T>
+	bool merge_parsed_file(const std::string& file_name, Course* course = nullptr) {
+		const auto it = m_pending_files.find(file_name);
+		if (it == m_pending_files.end()) { return false; }
+		std::vector<std::future<Parsed_File>> pending = std::move(it->second);
+		m_pending_files.erase(it);
+
+		bool failed{false};
+		for (std::future<Parsed_File>& chunk : pending) {
+			Parsed_File parsed{};
+			try { parsed = chunk.get(); }
+			catch (const std::exception& e) { parsed.error = e.what(); }
+			if (failed) {
+				// like a sequential read, nothing after an error is added.
+				for (Entity* entity : parsed.entities) { delete entity; }
+				continue;
+			}
+			failed = !merge_parsed_chunk<T>(parsed, file_name, course);
 		}
+		return true;
+	}
+
+	/**
+	 * helper function to merge one parsed chunk of the file of type T, in order.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param parsed - the parsed chunk.
+	 * @param file_name - name of the csv file.
+	 * @param course - optional pointer to course object to merge course types.
+	 * @return true if the whole chunk was merged, false if an error stopped it (the error is logged).
+	 */
+	template <typename T>
+	bool merge_parsed_chunk(Parsed_File& parsed, const std::string& file_name, Course* course) {
+		// the file was read from csv, so the snapshot is not up to date with it.
+		if (!parsed.from_snapshot) { m_snapshot_stale = true; }
+		size_t merged{};
+		try {
+			for (; merged < parsed.entities.size(); merged++) {
+				add_entity_to_collections(Entity::cast<T>(parsed.entities[merged]), file_name, course, false);
+			}
+		}
+		catch (const std::exception& e) {
+			// like a sequential read, the entities after an invalid one are not added.
+			for (; merged < parsed.entities.size(); merged++) { delete parsed.entities[merged]; }
+			if (parsed.error.empty()) { parsed.error = e.what(); }
+		}
+		if (!parsed.error.empty()) {
+			std::cerr << "Error reading " << (parsed.from_snapshot ? "snapshot" : "file") << ": " << file_name << ": "
+				<< parsed.error << std::endl;
+			// the file is missing or invalid, so it is written again on the next checkpoint.
+			mark_dirty(file_name);
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * helper function to add the rows of the file of type T to a snapshot.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param writer - the snapshot writer.
+	 * @param course - optional pointer to course object to add course types.
+	 */
+	template <typename T>
+	void add_to_snapshot(Catalog_Snapshot::Writer& writer, Course* course = nullptr) {
+		std::string file_name = get_file_name<T>(course);
+		if (course && !course->is_course_types_loaded()) {
+			// course types that were not loaded yet are copied from the current snapshot as is.
+			if (m_snapshot.is_fresh(file_name)) {
+				writer.copy_file(file_name, m_snapshot);
+				return;
+			}
+			/*not in the snapshot, the rows of the csv file are copied as is, without loading the course types.
+			note: loading them here would change the course while the snapshot is written.*/
+			writer.begin_file(file_name);
+			CSV_Editor::stream_csv(file_name, [&writer](const std::vector<std::string_view>& row) {
+				for (const std::string_view cell : row) { writer.add_cell(cell); }
+				writer.end_row();
+			});
+			writer.end_file();
+			return;
+		}
+		writer.begin_file(file_name);
+		prepare_data<T>(writer, file_name, course);
+		writer.end_file();
+	}
+
+	// write a new snapshot of the whole catalog (if it changed since the snapshot was written).
+	void write_snapshot() {
+		if (!m_snapshot_stale) { return; }
+		try {
+			Catalog_Snapshot::Writer writer{};
+			add_to_snapshot<Student>(writer);
+			add_to_snapshot<Teacher>(writer);
+			add_to_snapshot<Course>(writer);
+			for (const std::string& id : m_entity_order[Course::get_file_name()]) {
+				Course* course = get_entity<Course>(id);
+				add_to_snapshot<Lecture>(writer, course);
+				add_to_snapshot<Tutorial>(writer, course);
+				add_to_snapshot<Lab>(writer, course);
+			}
+			writer.save(durability);
+			m_snapshot_stale = false;
+			// map the new snapshot, the course types that are still not loaded are read from it.
+			m_snapshot.load();
+		}
+		catch (const std::exception& e) { std::cerr << "Error writing snapshot: " << e.what() << std::endl; }
 	}
 
 	/**
 	 * write entities of type T to csv file from m_entities and m_entity_order maps.
 	 * if course is provided, write course types (Lecture, Tutorial, Lab) for the course.
+	 * only writes the file if it was modified since it was last written (see m_dirty_files).
 	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
 	 * @param course - optional pointer to course object to write course types.
 	 */
 	template <typename T>
 	void write_entities(Course* course = nullptr) {
+		// a running compaction may still be writing older data to the same files.
+		wait_for_compaction();
+		// nothing was modified, no file needs to be written.
+		if (m_dirty_files.empty()) { return; }
 		// get file name for the entity type.
 		std::string file_name = get_file_name<T>(course);
-		try {
-			// prepare entity data for writing to csv file.
-			std::vector<std::vector<std::string>> data = prepare_data<T>(file_name, course);
-			// write data to csv file.
-			CSV_Editor::write_csv(file_name, data);
-			data.clear(); // clear the data vector.
+		if (is_dirty(file_name)) {
+			try {
+				// serialize the entities straight into the reused write buffer.
+				m_writer.clear();
+				prepare_data<T>(m_writer, file_name, course);
+				// write the buffer to the csv file (a temporary file with a single write, renamed over the file).
+				m_writer.save(file_name, durability);
+				m_dirty_files.erase(file_name); // the file is up to date.
+			}
+			catch (const std::exception& e) {
+				// log the error and throw the exception again.
+				std::cerr << "Error writing file: " << file_name << ": " << e.what() << std::endl;
+			}
 		}
-		catch (const std::exception& e) {
-			// log the error and throw the exception again.
-			std::cerr << "Error writing file: " << file_name << ": " << e.what() << std::endl;
+		// write the course types of the courses (only the files that were modified).
+		if constexpr (std::is_same_v<T, Course>) {
+			if (!course) { write_dirty_course_types(); }
 		}
+		// once every modified file is written, the csv files have all the records of the journal.
+		if (m_dirty_files.empty()) { clear_journal(); }
 	}
 
 	/**
@@ -90,69 +639,72 @@ class Entity_Manager {
 	 * can process entities of main types (Student, Teacher, Course) optional parameter course=nullptr.
 	 * and can process course types (Lecture, Tutorial, Lab) optional parameter course provided.
 	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @tparam Row - csv row type, vector of strings or vector of string views (see CSV_View).
 	 * @param file_name - name of the csv file.
 	 * @param row - vector of strings representing csv row.
 	 * @param course - optional pointer to course object to process course types.
 	 */
-	template <typename T>
-	void process_entity(const std::string& file_name, std::vector<std::string>& row,
-	                    Course* course = nullptr) {
-		T* entity{dynamic_cast<T*>(T::from_csv(row))}; // create entity from csv row and downcast to T*.
+	template <typename T, typename Row>
+	void process_entity(const std::string& file_name, const Row& row, Course* course = nullptr) {
+		T* entity{T::from_csv(row)}; // create entity from csv row.
 		// process entity to m_entities and m_entity_order maps.
 		add_entity_to_collections(entity, file_name, course, false);
 	}
 
 	/**
-	 * helper function to process course object from csv row and adds all course types to the course.
+	 * helper function to process course object from csv row.
+	 * the course types are not read here, they are read on first access (see load_course_types()).
 	 * @param course - pointer to course object to assign course types.
 	 */
 	void process_course(Course* course) {
 		try {
 			// check if the downcast from T* to Course* was successful.
 			if (!course) { throw std::invalid_argument("Failed to downcast Entity* to Course*."); }
-			// read and assign course types to current course.
-			read_entities<Lecture>(course);
-			read_entities<Tutorial>(course);
-			read_entities<Lab>(course);
+			// the course reads its course types through this manager on first access.
+			if (!m_course_types_loader_set) {
+				Course::set_course_types_loader([this](Course& lazy_course) { load_course_types(lazy_course); });
+				m_course_types_loader_set = true;
+			}
+			course->set_lazy_course_types();
 		}
 		catch (const std::exception&) {
 			throw; // rethrow the exception.
 		}
 	}
 
+	/**
+	 * helper function to read and assign all course types (Lecture, Tutorial, Lab) to a course.
+	 * called by the course on the first access to its course types.
+	 * @param course - course object to assign course types.
+	 */
+	void load_course_types(Course& course) {
+		read_entities<Lecture>(&course);
+		read_entities<Tutorial>(&course);
+		read_entities<Lab>(&course);
+	}
+
 	/**
 	 * helper function to prepare data for writing to csv file from m_entities and m_entity_order maps.
+	 * the rows are appended straight to the buffer (see append_csv()).
 	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @tparam Buffer - CSV_Writer or Catalog_Snapshot::Writer.
+	 * @param buffer - the buffer to append the rows to.
 	 * @param file_name - name of the csv file.
 	 * @param course - optional pointer to course object to prepare course types.
-	 * @return the data vector of rows to write to the csv file.
-	 */
-	template <typename T>
-	std::vector<std::vector<std::string>> prepare_data(std::string& file_name, Course* course = nullptr) {
-		std::vector<std::vector<std::string>> data{}; // create a data vector to store rows.
-		const std::vector<std::string>& order = m_entity_order[file_name]; // get the order of entities.
-		// iterate through entity_order and add only entities of type T to the data vector.
-		for (const std::string& id : order) {
-			T* entity{}; // create a pointer to entity.
-			if (!course) {
-				// if preparing an entity of main types (Student, Teacher, Course).
-				// get entity with id from the entities map and downcast it to T*.
-				entity = dynamic_cast<T*>(get_entity(id));
-				if (entity->get_type() == "Course") {
-					// downcast T* to Course* and prepare course.
-					prepare_course(dynamic_cast<Course*>(entity));
-				}
-			}
-			else {
-				// if preparing an entity of course types (Lecture, Tutorial, Lab).
-				entity = dynamic_cast<T*>(course->get_course_type(id));
-			}
-			// check if the downcast was successful.
+	 */
+	template <typename T, typename Buffer>
+	void prepare_data(Buffer& buffer, const std::string& file_name, Course* course = nullptr) {
+		const Entity_Order& order = m_entity_order[file_name]; // get the order of entities.
+		// iterate through entity_order and append only entities of type T to the buffer.
+		for (auto it = order.begin(); it != order.end(); ++it) {
+			// get the entity from the store of T (main types) or from the course (course types).
+			// note: the course types of courses are written by write_entities (see write_dirty_course_types).
+			T* entity = find_entity<T>(it.get_handle(), course);
+			// check if the entity was found.
 			check_entity(entity, "Entity was not found.");
-			// add course type to data.
-			data.push_back(entity->to_csv());
+			// append the entity row to the buffer.
+			entity->append_csv(buffer);
 		}
-		return data;
 	}
 
 	/**
@@ -175,6 +727,128 @@ class Entity_Manager {
 		}
 	}
 
+	/**
+	 * helper function to write the course types of all courses that have modified course type files.
+	 * used when the courses file itself is up to date.
+	 */
+	void write_dirty_course_types() {
+		for (const std::string& id : m_entity_order[Course::get_file_name()]) {
+			// stop once all modified files were written.
+			if (m_dirty_files.empty()) { return; }
+			prepare_course(get_entity<Course>(id));
+		}
+	}
+
+	/**
+	 * helper function to prepare the data of a modified file of type T for a compaction.
+	 * the file is no longer marked as modified, since the compaction writes it.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param files - vector of file names and data to add the file to.
+	 * @param course - optional pointer to course object to prepare course types.
+	 */
+	template <typename T>
+	void collect_dirty_file(std::vector<std::pair<std::string, CSV_Writer>>& files, Course* course = nullptr) {
+		std::string file_name = get_file_name<T>(course);
+		if (!is_dirty(file_name)) { return; }
+		CSV_Writer writer{};
+		prepare_data<T>(writer, file_name, course);
+		files.emplace_back(file_name, std::move(writer));
+		m_dirty_files.erase(file_name);
+	}
+
+	// wait for a running background compaction (if any) to finish writing its files.
+	void wait_for_compaction() {
+		if (m_compaction.valid()) { m_compaction.get(); }
+	}
+
+	// helper function to empty the journal, logs the error if it fails (the records are replayed again).
+	void clear_journal() {
+		try { m_journal.clear(); }
+		catch (const std::exception& e) { std::cerr << "Error clearing journal: " << e.what() << std::endl; }
+	}
+
+	/**
+	 * helper function to append a mutation of type T to the journal.
+	 * starts a compaction once the journal has compaction_threshold records.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param op - 'A' for add or 'R' for remove.
+	 * @param course - optional pointer to course object of course types.
+	 * @param fields - csv row of the added entity or the id of the removed entity.
+	 */
+	template <typename T>
+	void journal_mutation(const char op, const Course* course, const std::vector<std::string>& fields) {
+		if (m_replaying) { return; }
+		try { m_journal.append(op, T::get_file_name(), course ? course->get_id() : std::string{}, fields, durability); }
+		catch (const std::exception& e) { std::cerr << "Error writing journal: " << e.what() << std::endl; }
+		if (m_journal.get_record_count() >= compaction_threshold) { compact(); }
+	}
+
+	/**
+	 * replay the journal on top of the csv files read by the constructor.
+	 * the replayed mutations mark their files as modified, so the next checkpoint writes them.
+	 * @return true once the journal was replayed (errors are logged and skipped).
+	 */
+	bool recover() {
+		m_replaying = true;
+		try {
+			m_journal.replay([this](const std::vector<std::string_view>& record) {
+				try { replay_record(record); }
+				catch (const std::exception& e) {
+					std::cerr << "Error replaying journal record: " << e.what() << std::endl;
+				}
+			});
+		}
+		catch (const std::exception& e) { std::cerr << "Error reading journal: " << e.what() << std::endl; }
+		m_replaying = false;
+		return true;
+	}
+
+	// helper function to replay one journal record by the type of the record.
+	void replay_record(const std::vector<std::string_view>& record) {
+		if (record.size() < 4) { throw std::invalid_argument("Invalid journal record."); }
+		const std::string_view type = record[1];
+		if (type == Student::get_file_name()) { replay<Student>(record); }
+		else if (type == Teacher::get_file_name()) { replay<Teacher>(record); }
+		else if (type == Course::get_file_name()) { replay<Course>(record); }
+		else if (type == Lecture::get_file_name()) { replay<Lecture>(record); }
+		else if (type == Tutorial::get_file_name()) { replay<Tutorial>(record); }
+		else if (type == Lab::get_file_name()) { replay<Lab>(record); }
+		else { throw std::invalid_argument("Invalid journal record type: " + std::string{type}); }
+	}
+
+	/**
+	 * helper function to replay a journal record of type T (add or remove).
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
+	 * @param record - the journal record (op,type,course_id,fields...).
+	 */
+	template <typename T>
+	void replay(const std::vector<std::string_view>& record) {
+		Course* course{};
+		if constexpr (std::is_base_of_v<Course_Type, T>) {
+			// course types are replayed into their course.
+			course = get_entity<Course>(record[2]);
+			check_entity(course, "Course with id: " + std::string{record[2]} + " does not exist.");
+		}
+		const std::vector<std::string_view> fields(record.begin() + 3, record.end());
+		if (record[0] == "R") {
+			remove_entity<T>(std::string{fields[0]}, course);
+			return;
+		}
+		T* entity{T::from_csv(fields)};
+		try { add_entity<T>(entity, course); }
+		catch (...) {
+			delete entity; // the entity was not added.
+			throw;
+		}
+	}
+
+	// mark all course type files (Lecture, Tutorial, Lab) of a course as modified.
+	void mark_course_types_dirty(const Course* course) {
+		mark_dirty(get_file_name<Lecture>(course));
+		mark_dirty(get_file_name<Tutorial>(course));
+		mark_dirty(get_file_name<Lab>(course));
+	}
+
 	/**
 	 * helper function to remove all course types of type T from the course.
 	 * @param course - pointer to course object to remove course types.
@@ -196,75 +870,123 @@ class Entity_Manager {
 	}
 
 	/**
-	 * helper function to add entity to entities map and order.
+	 * helper function to add entity to its store (or course) and order.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
 	 * @param entity - pointer to entity object to add.
 	 * @param file_name - name of the csv file.
 	 * @param course - optional pointer to course object to add course types.
 	 * @param is_addition - flag to check if the entity is being added or processed.
 	 */
-	void add_entity_to_collections(Entity* entity, const std::string& file_name, Course* course = nullptr,
+	template <typename T>
+	void add_entity_to_collections(T* entity, const std::string& file_name, Course* course = nullptr,
 	                               bool is_addition = true) {
 		check_entity(entity, "Failed to create entity.");
-		const std::string& id = entity->get_id();
-		if (entity_exists(id, file_name)) { throw std::invalid_argument("Entity with id " + id + " already exists."); }
+		// load the course types first, so the check for duplicates sees them.
+		if (course) { course->load_course_types(); }
+		const std::string_view id = entity->get_id_view();
+		if (has_entity(id, file_name)) {
+			throw std::invalid_argument("Entity with id " + std::string{id} + " already exists.");
+		}
 
-		m_entity_order[file_name].push_back(id); // add id to entity order map.
-		if (!course) {
+		if constexpr (is_main_type<T>) {
 			// main types (Student, Teacher, Course).
-			m_entities[id] = entity; // add entity to entities map.
-			if (entity->get_type() == "Course") {
-				if (is_addition) {
-					prepare_course(dynamic_cast<Course*>(entity)); // downcast T* to Course* and prepare course.
-				} else {
-					process_course(dynamic_cast<Course*>(entity)); // downcast T* to Course* and process course.
-				}
+			if (course) { throw std::invalid_argument("Only course types can be added to a course."); }
+			if (!get_store<T>().add(entity)) {
+				throw std::invalid_argument("Entity with id " + std::string{id} + " already exists.");
 			}
 		}
 		else {
 			// course types (Lecture, Tutorial, Lab).
-			course->add_course_type(dynamic_cast<Course_Type*>(entity)); // add course type to course.
+			check_entity(course, "Course types can only be added to a course.");
+			// a published course is not changed (see get_writable_course()), loading its course types is not a change.
+			if (is_addition) { course = get_writable_course(course); }
+			course->add_course_type(entity); // add course type to course.
+			if (m_course_type_index_built) { m_course_type_index.add(course, entity); }
+		}
+		m_entity_order[file_name].push_back(id); // add id to entity order map.
+		if (is_addition) { mark_dirty(file_name); } // the file has to be written on the next checkpoint.
+		if constexpr (is_main_type<T>) {
+			// the next version has the new entity, and a new course can be changed in place.
+			if (m_garbage) { get_draft().get_list<T>().push_back(m_entity_order[file_name].find_cursor(id), entity); }
+			if constexpr (std::is_same_v<T, Course>) {
+				if (m_garbage) { m_unpublished_courses.insert(entity); }
+			}
+		}
+		if (m_search_index_built) {
+			// index the new entity, or the course again with its new course type.
+			if constexpr (is_main_type<T>) { get_search_index<T>().add(entity); }
+			else { m_course_index.update(course); }
+		}
+		if constexpr (std::is_same_v<T, Course>) {
+			if (m_prefix_index_built) { m_prefix_index.add(*entity); }
+			// the (empty) course type files of a new course are created on the next checkpoint.
+			if (is_addition) { mark_course_types_dirty(entity); }
+			else { process_course(entity); }
 		}
 	}
 
 
 	/**
-	 * helper function to remove entity from entities map and order.
+	 * helper function to remove entity from its store (or course) and order.
+	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
 	 * @param id - id of the entity to remove.
 	 * @param file_name - name of the csv file.
 	 * @param course - optional pointer to course object to remove course types.
 	 */
+	template <typename T>
 	void remove_entity_from_collections(const std::string& id, const std::string& file_name, Course* course = nullptr) {
-		std::vector<std::string>& order = m_entity_order[file_name]; // get the order of entities.
-		// use an iterator to find the id from the order vector and remove it.
-		for (auto it = order.begin(); it != order.end(); ++it) {
-			if (*it == id) {
-				// if id was found.
-				if (!course) {
-					// removing entity of main types (Student, Teacher, Course).
-					Entity* entity = m_entities[id]; // get the entity from entities map.
-					m_entities.erase(id); // remove entity from entities map.
-					// if the entity is of type Course, remove the course types (Lecture, Tutorial, Lab).
-					if (entity->get_type() == "Course") {
-						// downcast Entity* to Course* and remove course.
-						remove_course(dynamic_cast<Course*>(entity));
-					} // delete the entity object and avoid dangling pointer.
-					delete entity;
-					entity = nullptr;
-				}
-				else {
-					// removing entity of course types (Lecture, Tutorial, Lab).
-					course->remove_course_type(id);
+		// load the course types first, so the order has the id to remove.
+		if (course) { course->load_course_types(); }
+		Entity_Order& order = m_entity_order[file_name]; // get the order of entities.
+		// the id is looked up once, the order holds a reference to it until the end.
+		const Symbol_Table::Handle handle = Symbol_Table::get_instance().find(id);
+		// nothing to remove if the id is not in the order.
+		if (!order.contains(handle)) { return; }
+		if constexpr (is_main_type<T>) {
+			// removing entity of main types (Student, Teacher, Course).
+			T* entity = get_store<T>().remove(handle); // remove entity from its store.
+			get_search_index<T>().remove(handle); // so the index does not refer to the deleted entity.
+			// the next version does not have the entity.
+			if (m_garbage) { get_draft().get_list<T>().erase(order.find_cursor(handle)); }
+			// if the entity is of type Course, remove the course types (Lecture, Tutorial, Lab).
+			if constexpr (std::is_same_v<T, Course>) {
+				if (entity) {
+					if (m_prefix_index_built) { m_prefix_index.remove(*entity); }
+					remove_course(entity);
 				}
-				order.erase(it); // remove id from the entity order map.
-				break; // break the loop.
-			}
+			} // delete the entity object (once no version has it) and avoid dangling pointer.
+			retire(entity);
+			entity = nullptr;
+		}
+		else {
+			// removing entity of course types (Lecture, Tutorial, Lab).
+			check_entity(course, "Course types can only be removed from a course.");
+			course = get_writable_course(course); // a published course is not changed.
+			// the index refers to the course type, so it is removed from the index before it is deleted.
+			if (m_course_type_index_built) { m_course_type_index.remove(course->get_course_type(handle)); }
+			retire(course->release_course_type(id));
+			if (m_search_index_built) { m_course_index.update(course); } // without the removed course type.
 		}
+		order.erase(handle); // remove id from the entity order map (the order of the other ids is kept).
+		mark_dirty(file_name); // the file has to be written on the next checkpoint.
+	}
+
+	// helper function to print the entities of main type T under the name of their file.
+	template <typename T>
+	void print_file() const {
+		if (m_entity_order.find(T::get_file_name()) == m_entity_order.end()) { return; }
+		std::cout << "File: " << T::get_file_name() << std::endl;
+		print_entities<T>();
+		std::cout << std::endl;
 	}
 
 	// helper function to get the file name for the entity type.
 	template <typename T>
 	static std::string get_file_name(const Course* course = nullptr) {
-		return course ? course->get_id() + T::get_file_name() : T::get_file_name();
+		if (!course) { return T::get_file_name(); }
+		std::string file_name{course->get_id_view()};
+		file_name += T::get_file_name();
+		return file_name;
 	}
 
 	// helper function to check entity and throw an exception if not null.
@@ -280,9 +1002,105 @@ public:
 	static Entity_Manager& get_instance() {
 		// since static var are defined only once, there will be only one instnace.
 		static Entity_Manager instance;
+		// replay the journal once, on top of the csv files read by the constructor.
+		static const bool recovered{instance.recover()};
+		static_cast<void>(recovered);
 		return instance;
 	}
 
+	/*lock of the catalog for a command that only reads it (see read_lock()).
+	reads load the course types and build the indexes on first use, so the lock is only shared once
+	prepare_concurrent_reads() loaded them. before that it is exclusive, so a read that loads them does not run
+	next to other reads (a single session, like the CLI, keeps loading the course types lazily).*/
+	class Read_Lock {
+		std::shared_lock<std::shared_mutex> m_shared{};
+		std::unique_lock<std::shared_mutex> m_exclusive{};
+
+	public:
+		explicit Read_Lock(const Entity_Manager& manager) {
+			if (manager.m_concurrent_reads_prepared.load(std::memory_order_acquire)) {
+				m_shared = std::shared_lock<std::shared_mutex>{manager.m_mutex};
+				// still prepared now that the catalog is locked.
+				if (manager.m_concurrent_reads_prepared.load(std::memory_order_acquire)) { return; }
+				m_shared.unlock();
+			}
+			m_exclusive = std::unique_lock<std::shared_mutex>{manager.m_mutex};
+		}
+	};
+
+	/**
+	 * lock the catalog for a command that only reads it (get_entity, print_entities, search_entites, ...).
+	 * after prepare_concurrent_reads(), reads of several threads run in parallel and a mutation waits until they
+	 * are done. before it, the reads are run one at a time (see Read_Lock).
+	 * @return the lock, held until it is destroyed.
+	 */
+	Read_Lock read_lock() const { return Read_Lock{*this}; }
+
+	/*exclusive lock of the catalog for a command that changes it (see write_lock()).
+	when it is released, the version the command made is published (see pin_version()),
+	so the readers of versions see all the changes of the command or none of them.*/
+	class Write_Lock {
+		Entity_Manager* m_manager{};
+		std::unique_lock<std::shared_mutex> m_lock{};
+
+		// publish the version and unlock.
+		void release() {
+			if (m_manager) { m_manager->publish_version(); }
+			m_manager = nullptr;
+			if (m_lock.owns_lock()) { m_lock.unlock(); }
+		}
+
+	public:
+		Write_Lock() = default; // does not lock.
+		explicit Write_Lock(Entity_Manager& manager) : m_manager{&manager}, m_lock{manager.m_mutex} {}
+		Write_Lock(Write_Lock&& other) noexcept
+			: m_manager{std::exchange(other.m_manager, nullptr)}, m_lock{std::move(other.m_lock)} {}
+		Write_Lock& operator=(Write_Lock&& other) noexcept {
+			if (this != &other) {
+				release();
+				m_manager = std::exchange(other.m_manager, nullptr);
+				m_lock = std::move(other.m_lock);
+			}
+			return *this;
+		}
+		~Write_Lock() { release(); }
+	};
+
+	/**
+	 * lock the catalog for a command that changes it (add_entity, remove_entity, checkpoint, ...).
+	 * @return the exclusive lock, held until it is destroyed.
+	 */
+	Write_Lock write_lock() { return Write_Lock{*this}; }
+
+	/**
+	 * pin the current version of the students, teachers and courses, to read it without locking the catalog.
+	 * the version does not change, and its entities are not deleted, while the returned pointer is held.
+	 * note: the first pin builds the version under the write lock, so it can not be called under read_lock().
+	 * @return the pinned version.
+	 */
+	std::shared_ptr<const Catalog_Version> pin_version() {
+		std::shared_ptr<const Catalog_Version> version{std::atomic_load(&m_version)};
+		if (version) { return version; }
+		const Write_Lock lock{write_lock()};
+		build_version();
+		return std::atomic_load(&m_version);
+	}
+
+	/**
+	 * load what the reads would load on first use: the course types of all courses,
+	 * the search, prefix and course type indexes, and the first version (see pin_version()).
+	 * after that the reads do not change the catalog, so read_lock() shares the catalog between several threads.
+	 * the mutations keep the indexes up to date, and the courses they add have their course types loaded.
+	 */
+	void prepare_concurrent_reads() {
+		const Write_Lock lock{write_lock()};
+		build_search_index(); // loads the course types of all courses.
+		build_prefix_index();
+		build_course_type_index();
+		build_version();
+		m_concurrent_reads_prepared.store(true, std::memory_order_release);
+	}
+
 	/**
 	 * add entity of type T to entities map and order.
 	 * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
@@ -294,7 +1112,9 @@ public:
 		// get the file name for the entity type.
 		const std::string file_name = get_file_name<T>(course);
 		// add entity to entities map and order.
-		add_entity_to_collections(dynamic_cast<T*>(entity), file_name, course);
+		add_entity_to_collections(Entity::cast<T>(entity), file_name, course);
+		// append the mutation to the journal, so it is not lost before the next checkpoint.
+		journal_mutation<T>('A', course, entity->to_csv());
 	}
 
 	/**
@@ -308,7 +1128,9 @@ public:
 		// get the file name for the entity type.
 		const std::string file_name = get_file_name<T>(course);
 		// remove entity from entities map and order.
-		remove_entity_from_collections(id, file_name, course);
+		remove_entity_from_collections<T>(id, file_name, course);
+		// append the mutation to the journal, so it is not lost before the next checkpoint.
+		journal_mutation<T>('R', course, {id});
 	}
 
 	/**
@@ -321,11 +1143,24 @@ public:
 	void remove_all_course_types(Course* course) {
 		// get file name for course type csv file.
 		const std::string file_name = course->get_id() + T::get_file_name();
-		// remove course type order from the entity order map.
-		for (const std::string& id : m_entity_order[file_name]) {
-			remove_entity_from_collections(id, file_name, course);
+		// load the course types first, so the order has all the ids to remove.
+		course->load_course_types();
+		// a course that is being removed keeps its course types, they are deleted with it (see retire()).
+		const bool is_removed = get_entity<Course>(course->get_id_view()) != course &&
+			m_course_copies.find(course) == m_course_copies.end();
+		if (!is_removed) { course = get_writable_course(course); } // a published course is not changed.
+		// remove the course types of the order, then the whole order at once (not one id at a time).
+		const auto it = m_entity_order.find(file_name);
+		if (it != m_entity_order.end()) {
+			for (auto id = it->second.begin(); id != it->second.end(); ++id) {
+				if (m_course_type_index_built) { m_course_type_index.remove(course->get_course_type(id.get_handle())); }
+				if (!is_removed) { retire(course->release_course_type(*id)); }
+			}
+			m_entity_order.erase(it); // erase the course type order.
 		}
-		m_entity_order.erase(file_name); // erase the course type order.
+		m_dirty_files.erase(file_name); // the file is deleted, so there is nothing to write.
+		m_snapshot_stale = true; // the snapshot still has the course types.
+		wait_for_compaction(); // so a running compaction does not write the file again.
 		CSV_Editor::delete_csv(file_name); // delete the course type csv file.
 	}
 
@@ -340,14 +1175,16 @@ public:
 	void print_entity(const std::string& id, const Course* course = nullptr) const {
 			// get the file name for the entity type.
 			const std::string file_name = get_file_name<T>(course);
+			// the id is looked up once for the order and the store.
+			const Symbol_Table::Handle handle = Symbol_Table::get_instance().find(id);
 			// check if the entity exists, else throw an exception.
-			if (!entity_exists(id, file_name)) {
+			if (!has_entity(handle, file_name)) {
 				throw std::invalid_argument("Entity with id: " + id + " was not found.");
 			}
 
-			// get the entity and downcast it to the derived type.
-			const Entity* entity = dynamic_cast<const T*>(get_entity(id));
-			// check if downcast was successful, else throw an exception.
+			// get the entity from the store of T (or the course type of the course).
+			const Entity* entity = find_entity<T>(handle, course);
+			// check if the entity was found, else throw an exception.
 			check_entity(entity, "Entity was not found.");
 			std::cout << *entity << std::endl; // print the entity.
 	}
@@ -358,58 +1195,57 @@ public:
 	 */
 	template <typename T>
 	void print_entities(Course* course = nullptr) const {
+		// load the course types of the course on first access.
+		if (course) { course->load_course_types(); }
 		// get the file name for the entity type.
 		const std::string file_name = get_file_name<T>(course);
-		const std::vector<std::string>& order = m_entity_order.at(file_name); // get the order of entities.
+		const Entity_Order& order = m_entity_order.at(file_name); // get the order of entities.
 		// iterate over the order of T
-		for (const std::string& id : order) {
-			// get the base class entity and downcast it to the derived type.
-			const T* entity = dynamic_cast<const T*>(get_entity(id));
-			// check if downcast was successful, else throw an exception.
+		for (auto it = order.begin(); it != order.end(); ++it) {
+			// get the entity from the store of T (or the course type of the course), by the handle of the order.
+			const T* entity = find_entity<T>(it.get_handle(), course);
+			// check if the entity was found, else throw an exception.
 			check_entity(entity, "Entity was not found.");
 			std::cout << *entity << std::endl; // print the entity.
 		}
 	}
 
+	/**
+	 * search for text in the entities of main type T and print the matches in the order of the entity type.
+	 * uses the search index of T, so only the entities that may have the text are checked (see Search_Index).
+	 * @tparam T - type of entity (Student, Teacher, Course).
+	 * @param text - the text to search for.
+	 * @return true if any entity was found, false otherwise.
+	 */
 	template <typename T>
 	bool search_entites(const std::string& text) {
-		bool found{};
-		// get the entity manager instance and from it get the entity order.
-		// iterate over the order of specified type of entity.
+		std::vector<std::pair<Symbol_Table::Handle, const T*>> matches{};
 		try {
-			const std::vector<std::string>& order = get_entity_order<T>();
-			// if order is empty, return false.
-			for (const std::string& id : order) {
-				// get the base class entity and downcast it to the derived type.
-				const T* entity = dynamic_cast<const T*>(get_entity(id));
-				// check if downcast was successful, else throw an exception.
-				if (!entity) {
-					throw std::invalid_argument("Entity with id: " + id + " was not found.");
-				}
-				// use the derived entity to search for text.
-				if (entity->search(text)) {
-					if (!found) {
-						std::cout << "Found in " << T::get_file_name() << ":" << std::endl;
-						found = true;
-					}
-					std::cout << *entity << std::endl; // print the entity.
-				}
-			}
+			const Entity_Order& order = get_entity_order<T>();
+			build_search_index();
+			matches = get_search_index<T>().search(text);
+			// print the matches in the order of the entity type, like a walk over the order.
+			std::sort(matches.begin(), matches.end(), [&order](const auto& first, const auto& second) {
+				return order.get_position(first.first) < order.get_position(second.first);
+			});
 		}
 		catch (const std::exception&) {
 			return false;
 		}
-		return found;
+		if (matches.empty()) { return false; }
+		std::cout << "Found in " << T::get_file_name() << ":" << std::endl;
+		for (const auto& match : matches) { std::cout << *match.second << std::endl; } // print the entity.
+		return true;
 	}
 
 
 	/**
      * get the order of entities of type T from the entity order map.
      * @tparam T - type of entity (Student, Teacher, Course, Lecture, Tutorial, Lab).
-     * @return vector of ids in order of the entity type.
+     * @return ids in order of the entity type (see Entity_Order).
      */
 	template <typename T>
-	const std::vector<std::string>& get_entity_order() const {
+	const Entity_Order& get_entity_order() const {
 		// if entity order map is empty, throw an exception.
 		if (m_entity_order.empty()) { throw std::invalid_argument("Entity order map is empty."); }
 		// check if the entity type exists in the entity order map.
@@ -422,8 +1258,127 @@ public:
 		// log the error and throw the exception again.
 	}
 
-	// print all entities by order.
-	void print_all_entities() const;
+	/**
+	 * complete a prefix with the course ids, course names and lecturer names that start with it.
+	 * the prefix index is built on the first completion, then kept up to date when courses are added or removed.
+	 * @param prefix - the typed prefix.
+	 * @param limit - maximum number of completions.
+	 * @return the completions, sorted by text (see Prefix_Index).
+	 */
+	std::vector<Prefix_Index::Completion> complete(const std::string_view prefix, const size_t limit) {
+		build_prefix_index();
+		return m_prefix_index.complete(prefix, limit);
+	}
+
+	/**
+	 * find the course types of all courses that match a query (by day, classroom, lecturer and start hour).
+	 * the index is built on the first query (it loads the course types of all courses),
+	 * then kept up to date when course types are added or removed.
+	 * @param query - the fields to match.
+	 * @return the matches, sorted by course id and group id (valid until the catalog changes).
+	 */
+	std::vector<Course_Type_Index::Match> find_course_types(const Course_Type_Index::Query& query) {
+		build_course_type_index();
+		return m_course_type_index.find(query);
+	}
+
+	// print all entities of main types (Student, Teacher, Course) by order.
+	void print_catalog() const {
+		print_file<Student>();
+		print_file<Teacher>();
+		print_file<Course>();
+	}
+
+	/**
+	 * prefetch the course types (Lecture, Tutorial, Lab) of a course, instead of loading them on first access.
+	 * @param course_id - id of the course.
+	 */
+	void prefetch_course_types(const std::string& course_id) const {
+		const Course* course = get_entity<Course>(course_id);
+		check_entity(course, "Course with id: " + course_id + " does not exist.");
+		course->load_course_types();
+	}
+
+	// prefetch the course types of all courses.
+	// the files of the courses that were not loaded yet are parsed on the thread pool, then merged in course order.
+	void prefetch_all_course_types() {
+		const Entity_Order& order = m_entity_order.at(Course::get_file_name());
+		if (is_parallel_load()) {
+			check_snapshot();
+			for (auto it = order.begin(); it != order.end(); ++it) {
+				const Course* course = m_courses.get(it.get_handle());
+				if (!course || course->is_course_types_loaded()) { continue; }
+				submit_file<Lecture>(course);
+				submit_file<Tutorial>(course);
+				submit_file<Lab>(course);
+			}
+		}
+		// loading the course types merges the parsed files (see read_entities).
+		for (const std::string& id : order) { prefetch_course_types(id); }
+	}
+
+	// enable or disable parsing the catalog files on the thread pool, before the first get_instance().
+	static void set_parallel_load(const bool enabled) { parallel_load = enabled; }
+
+	// set what a write of a csv file, the snapshot or a journal record waits for (default: none, the data is in the
+	// page cache). with none a journaled mutation survives a crash of the process but not a power failure.
+	static void set_durability(const CSV_Writer::Durability policy) { durability = policy; }
+
+	// write all files that were modified since the last checkpoint (the destructor does the same on exit).
+	// then write the snapshot, after the csv files so it is newer than all of them.
+	void checkpoint() {
+		write_entities<Student>();
+		write_entities<Teacher>();
+		write_entities<Course>();
+		write_snapshot();
+	}
+
+	/**
+	 * compact the journal into the csv files.
+	 * the data of all modified files is prepared on the calling thread and the journal is rotated,
+	 * then the files are written on a background thread while new mutations go to a new journal.
+	 * if writing fails, the rotated journal is kept and replayed on the next startup.
+	 */
+	void compact() {
+		wait_for_compaction();
+		std::vector<std::pair<std::string, CSV_Writer>> files{};
+		try {
+			collect_dirty_file<Student>(files);
+			collect_dirty_file<Teacher>(files);
+			collect_dirty_file<Course>(files);
+			for (const std::string& id : m_entity_order[Course::get_file_name()]) {
+				if (m_dirty_files.empty()) { break; }
+				Course* course = get_entity<Course>(id);
+				collect_dirty_file<Lecture>(files, course);
+				collect_dirty_file<Tutorial>(files, course);
+				collect_dirty_file<Lab>(files, course);
+			}
+			m_journal.rotate();
+		}
+		catch (const std::exception& e) {
+			// the files stay modified, so they are written on the next checkpoint.
+			for (const auto& file : files) { mark_dirty(file.first); }
+			std::cerr << "Error compacting journal: " << e.what() << std::endl;
+			return;
+		}
+		// the data was copied, so the catalog can keep changing while the files are written.
+		m_compaction = std::async(std::launch::async, [this, files = std::move(files)]() {
+			try {
+				for (const auto& [file_name, writer] : files) { writer.save(file_name, durability); }
+				m_journal.remove_rotated();
+			}
+			catch (const std::exception& e) { std::cerr << "Error compacting journal: " << e.what() << std::endl; }
+		});
+	}
+
+	// mark a file (key of the entity order map) as modified, so it is written on the next checkpoint.
+	void mark_dirty(const std::string& file_name) {
+		m_dirty_files.insert(file_name);
+		m_snapshot_stale = true;
+	}
+
+	// check if a file (key of the entity order map) was modified since it was last written.
+	bool is_dirty(const std::string& file_name) const { return m_dirty_files.count(file_name) > 0; }
 
 	/**
 	 * check if entity with id exists in both entities map and order map.
@@ -435,19 +1390,47 @@ public:
 	 * @param file_name - name of the csv file.
 	 * @return true if entity exists, false otherwise.
 	 */
-	bool entity_exists(const std::string& id, const std::string& file_name) const;
+	bool has_entity(const std::string_view id, const std::string& file_name) const {
+		return has_entity(Symbol_Table::get_instance().find(id), file_name);
+	}
+
+	// check if entity with the handle of an id exists in the order of file_name (see has_entity(id)).
+	bool has_entity(const Symbol_Table::Handle handle, const std::string& file_name) const {
+		// O(1) lookup in the index of the order (see Entity_Order).
+		const auto it = m_entity_order.find(file_name);
+		return it != m_entity_order.end() && it->second.contains(handle);
+	}
 
 	/**
-	 * get entity by id from the entities map.
-	 * note: gets entities of only main types (Student, Teacher, Course).
+	 * get entity of type T by id from the store of T, no cast needed.
+	 * example: get_entity<Course>(id) to get a course.
+	 * @tparam T - type of entity (Student, Teacher, Course).
 	 * @param id - id of the entity.
 	 * @return pointer to the entity if found, nullptr otherwise.
 	 */
-	Entity* get_entity(const std::string& id) const;
+	template <typename T>
+	T* get_entity(const std::string_view id) const { return get_store<T>().get(id); }
 
+	/**
+	 * get entity by id from the stores of main types (Student, Teacher, Course).
+	 * note: a student, a teacher and a course can have the same id, the first one is returned in that order.
+	 * prefer get_entity<T>(id) when the type is known.
+	 * @param id - id of the entity.
+	 * @return pointer to the entity if found, nullptr otherwise.
+	 */
+	Entity* find_any_entity(const std::string_view id) const {
+		if (Student* student = m_students.get(id)) { return student; }
+		if (Teacher* teacher = m_teachers.get(id)) { return teacher; }
+		return m_courses.get(id);
+	}
 
-	// get entities map.
-	const std::unordered_map<std::string, Entity*>& get_entities() const;
+	/**
+	 * get the entities of type T (not in file order, see get_entity_order()).
+	 * @tparam T - type of entity (Student, Teacher, Course).
+	 * @return the store of the entities.
+	 */
+	template <typename T>
+	const Entity_Store<T>& get_entities() const { return get_store<T>(); }
 };
 
 #endif //ENTITY_MANAGER_H
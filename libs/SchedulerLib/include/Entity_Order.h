@@ -0,0 +1,246 @@
+#ifndef ENTITY_ORDER_H
+#define ENTITY_ORDER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Symbol_Table.h"
+
+// Entity Order class keeps the ids of a csv file in insertion order (the order the file is written in).
+// add, remove and lookup of an id are O(1): an index maps each id to its position in the order,
+// and a removed id leaves a tombstone instead of shifting the ids after it.
+// the tombstones are dropped once they are the majority of the order.
+// iterating skips the tombstones, so it can be used like the vector of ids it replaces.
+// the ids are interned (see Symbol_Table), the order keeps handles and pointers to the interned ids, not copies.
+// the order holds a reference to each of its ids, which is released when the id is removed.
+// every added id gets the next sequence number, so a position can be kept as a Cursor that outlives the compaction.
+class Entity_Order {
+	// an id in the order, removed ids are kept as tombstones (without an id) until the order is compacted.
+	struct Slot {
+		const std::string* id{}; // the interned id, nullptr for a tombstone.
+		Symbol_Table::Handle handle{};
+		uint64_t sequence{}; // increases along m_slots, never reused.
+	};
+
+	// minimum number of tombstones before the order is compacted.
+	static constexpr size_t min_compaction = 32;
+
+	std::vector<Slot> m_slots{};
+	// keys - handles of the ids, values - position of the id in m_slots.
+	std::unordered_map<Symbol_Table::Handle, size_t> m_positions{};
+	size_t m_removed_count{}; // number of tombstones in m_slots.
+	// sequence number of the next added id, not reset by clear() so the cursors of the old ids stay behind it.
+	uint64_t m_next_sequence{};
+
+	// drop the tombstones and update the positions of the ids that moved.
+	void compact() {
+		size_t next{};
+		for (size_t i = 0; i < m_slots.size(); i++) {
+			if (!m_slots[i].id) { continue; }
+			if (i != next) {
+				m_slots[next] = m_slots[i];
+				m_positions[m_slots[next].handle] = next;
+			}
+			++next;
+		}
+		m_slots.resize(next);
+		m_removed_count = 0;
+	}
+
+public:
+	// forward iterator over the ids that were not removed, in order.
+	class const_iterator {
+		friend class Entity_Order;
+
+		const Slot* m_slot{};
+		const Slot* m_end{};
+
+		// skip tombstones.
+		void skip() {
+			while (m_slot != m_end && !m_slot->id) { ++m_slot; }
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::string;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::string*;
+		using reference = const std::string&;
+
+		const_iterator() = default;
+		const_iterator(const Slot* slot, const Slot* end) : m_slot{slot}, m_end{end} { skip(); }
+
+		reference operator*() const { return *m_slot->id; }
+		pointer operator->() const { return m_slot->id; }
+		// get the handle of the id, to look it up in the maps keyed by handles without hashing the id again.
+		Symbol_Table::Handle get_handle() const { return m_slot->handle; }
+
+		const_iterator& operator++() {
+			++m_slot;
+			skip();
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator copy{*this};
+			++*this;
+			return copy;
+		}
+
+		bool operator==(const const_iterator& other) const { return m_slot == other.m_slot; }
+		bool operator!=(const const_iterator& other) const { return m_slot != other.m_slot; }
+	};
+
+	// the ids can not be changed in place (the index would be out of date).
+	using iterator = const_iterator;
+
+	Entity_Order() = default;
+	// no copy since the order holds a reference to each of its ids.
+	Entity_Order(const Entity_Order&) = delete;
+	Entity_Order& operator=(const Entity_Order&) = delete;
+	~Entity_Order() { clear(); }
+
+	const_iterator begin() const { return {m_slots.data(), m_slots.data() + m_slots.size()}; }
+	const_iterator end() const { return {m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()}; }
+
+	// get the number of ids (without tombstones).
+	size_t size() const { return m_positions.size(); }
+	bool empty() const { return m_positions.empty(); }
+
+	/*an opaque position in the order, between the ids that were added before it and the ids after it.
+	a cursor stays valid when ids are added or removed (even the id it points at) and when the order is compacted,
+	a default cursor is the start of the order.*/
+	class Cursor {
+		friend class Entity_Order;
+		uint64_t m_sequence{}; // sequence number of the first id at or after the cursor.
+
+	public:
+		bool operator==(const Cursor& other) const { return m_sequence == other.m_sequence; }
+		bool operator!=(const Cursor& other) const { return m_sequence != other.m_sequence; }
+		// the cursors of the ids are in the order of the ids.
+		bool operator<(const Cursor& other) const { return m_sequence < other.m_sequence; }
+
+		// get the cursor after the id of this cursor (before the ids after it).
+		Cursor next() const {
+			Cursor cursor{};
+			cursor.m_sequence = m_sequence + 1;
+			return cursor;
+		}
+	};
+
+	/**
+	 * get the first id at or after a cursor.
+	 * O(log n), the sequence numbers of the slots (tombstones included) are sorted.
+	 * @param cursor - a cursor of this order (see get_cursor()).
+	 * @return iterator to the id, end() if there are no ids after the cursor.
+	 */
+	const_iterator seek(const Cursor& cursor) const {
+		const auto it = std::lower_bound(m_slots.begin(), m_slots.end(), cursor.m_sequence,
+		                                 [](const Slot& slot, const uint64_t sequence) {
+			                                 return slot.sequence < sequence;
+		                                 });
+		return {m_slots.data() + (it - m_slots.begin()), m_slots.data() + m_slots.size()};
+	}
+
+	/**
+	 * get the cursor before the id of an iterator (resume with seek() to get the id again).
+	 * @param it - iterator of this order, end() for the cursor after the last id (the ids added later come after it).
+	 * @return the cursor.
+	 */
+	Cursor get_cursor(const const_iterator& it) const {
+		Cursor cursor{};
+		cursor.m_sequence = it.m_slot != it.m_end ? it.m_slot->sequence : m_next_sequence;
+		return cursor;
+	}
+
+	// returned by get_position() for an id that is not in the order.
+	static constexpr size_t no_position = SIZE_MAX;
+
+	/**
+	 * get the position of an id in the order, ids that come first have lower positions.
+	 * note: positions change when the tombstones are dropped, but their order does not.
+	 * @param handle - handle of the id (see Symbol_Table).
+	 * @return the position of the id, no_position if the order does not have it.
+	 */
+	size_t get_position(const Symbol_Table::Handle handle) const {
+		const auto it = m_positions.find(handle);
+		return it != m_positions.end() ? it->second : no_position;
+	}
+
+	/**
+	 * get the cursor before an id (seek() returns the id, while it is in the order).
+	 * @param id - the id.
+	 * @return the cursor of the id, the cursor after the last id if the order does not have it.
+	 */
+	Cursor find_cursor(const std::string_view id) const { return find_cursor(Symbol_Table::get_instance().find(id)); }
+
+	// get the cursor before the id of a handle (see find_cursor(id), no_handle for the cursor after the last id).
+	Cursor find_cursor(const Symbol_Table::Handle handle) const {
+		const size_t position = handle != Symbol_Table::no_handle ? get_position(handle) : no_position;
+		Cursor cursor{};
+		cursor.m_sequence = position != no_position ? m_slots[position].sequence : m_next_sequence;
+		return cursor;
+	}
+
+	// check if the order has an id.
+	bool contains(const std::string_view id) const { return contains(Symbol_Table::get_instance().find(id)); }
+
+	// check if the order has the id of a handle (no_handle is never in the order).
+	bool contains(const Symbol_Table::Handle handle) const { return m_positions.find(handle) != m_positions.end(); }
+
+	/**
+	 * add an id to the end of the order.
+	 * @param id - the id to add.
+	 * @return true if the id was added, false if the order already has it.
+	 */
+	bool push_back(const std::string_view id) {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.intern(id);
+		if (!m_positions.emplace(handle, m_slots.size()).second) {
+			table.release(handle); // the order already holds a reference to the id.
+			return false;
+		}
+		m_slots.push_back({&table.get_id(handle), handle, m_next_sequence++});
+		return true;
+	}
+
+	/**
+	 * remove an id from the order, the ids after it keep their order.
+	 * note: may drop the tombstones, which invalidates iterators (like vector::erase).
+	 * @param id - the id to remove.
+	 * @return true if the id was removed, false if the order does not have it.
+	 */
+	bool erase(const std::string_view id) { return erase(Symbol_Table::get_instance().find(id)); }
+
+	// remove the id of a handle from the order (see erase(id)).
+	bool erase(const Symbol_Table::Handle handle) {
+		const auto it = m_positions.find(handle);
+		if (it == m_positions.end()) { return false; }
+		m_slots[it->second].id = nullptr; // leave a tombstone.
+		m_positions.erase(it);
+		Symbol_Table::get_instance().release(handle);
+		if (++m_removed_count >= min_compaction && m_removed_count * 2 >= m_slots.size()) { compact(); }
+		return true;
+	}
+
+	// remove all ids.
+	void clear() {
+		if (!m_slots.empty()) {
+			Symbol_Table& table = Symbol_Table::get_instance();
+			for (const Slot& slot : m_slots) {
+				if (slot.id) { table.release(slot.handle); }
+			}
+		}
+		m_slots.clear();
+		m_positions.clear();
+		m_removed_count = 0;
+	}
+};
+
+#endif // ENTITY_ORDER_H
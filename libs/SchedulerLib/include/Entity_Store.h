@@ -0,0 +1,136 @@
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Symbol_Table.h"
+
+/**
+ * Entity Store class keeps the entities of a single type (Student, Teacher or Course) by id.
+ * the entities are kept in a contiguous vector with a hash index from id to position,
+ * so a lookup returns T* without a cast and iterating the entities of a type does not touch other types.
+ * since every type has its own store, a student and a teacher with the same id do not replace each other.
+ * the index is keyed by the interned handles of the ids (see Symbol_Table), the store holds a reference to each.
+ * note: the store does not own the entities, they are deleted by Entity_Manager.
+ * the iteration order is not the file order (see Entity_Order), removing an entity moves the last one in its place.
+ * @tparam T - type of the entities.
+ */
+template <typename T>
+class Entity_Store {
+	std::vector<T*> m_entities{};
+	std::vector<Symbol_Table::Handle> m_handles{}; // handles of the ids of m_entities, in the same positions.
+	// keys - handles of the entity ids, values - position of the entity in m_entities.
+	std::unordered_map<Symbol_Table::Handle, size_t> m_index{};
+
+	// helper function to find the position of an id in the index.
+	typename std::unordered_map<Symbol_Table::Handle, size_t>::const_iterator find(const std::string_view id) const {
+		return m_index.find(Symbol_Table::get_instance().find(id));
+	}
+
+public:
+	using const_iterator = typename std::vector<T*>::const_iterator;
+
+	Entity_Store() = default;
+	// no copy since the store holds a reference to the id of each entity.
+	Entity_Store(const Entity_Store&) = delete;
+	Entity_Store& operator=(const Entity_Store&) = delete;
+	~Entity_Store() { clear(); }
+
+	const_iterator begin() const { return m_entities.begin(); }
+	const_iterator end() const { return m_entities.end(); }
+
+	// get the number of entities.
+	size_t size() const { return m_entities.size(); }
+	bool empty() const { return m_entities.empty(); }
+
+	// check if the store has an entity with id.
+	bool contains(const std::string_view id) const { return find(id) != m_index.end(); }
+
+	/**
+	 * get entity by id.
+	 * @param id - id of the entity.
+	 * @return pointer to the entity if found, nullptr otherwise.
+	 */
+	T* get(const std::string_view id) const {
+		const auto it = find(id);
+		return it != m_index.end() ? m_entities[it->second] : nullptr;
+	}
+
+	// get entity by the handle of its id (see Entity_Order::const_iterator::get_handle()).
+	T* get(const Symbol_Table::Handle handle) const {
+		const auto it = m_index.find(handle);
+		return it != m_index.end() ? m_entities[it->second] : nullptr;
+	}
+
+	/**
+	 * add an entity to the store.
+	 * @param entity - pointer to the entity to add (not null).
+	 * @return true if the entity was added, false if the store already has its id.
+	 */
+	bool add(T* entity) {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.intern(entity->get_id_view());
+		if (!m_index.emplace(handle, m_entities.size()).second) {
+			table.release(handle); // the store already holds a reference to the id.
+			return false;
+		}
+		m_entities.push_back(entity);
+		m_handles.push_back(handle);
+		return true;
+	}
+
+	/**
+	 * replace the entity that has the id of an entity (with a copy of it, see Entity_Manager::get_writable_course()).
+	 * @param entity - pointer to the new entity (not null).
+	 * @return pointer to the replaced entity, nullptr if the store does not have the id (nothing is replaced).
+	 */
+	T* replace(T* entity) {
+		const auto it = find(entity->get_id_view());
+		if (it == m_index.end()) { return nullptr; }
+		T* replaced = m_entities[it->second];
+		m_entities[it->second] = entity;
+		return replaced;
+	}
+
+	/**
+	 * remove an entity from the store, the last entity is moved to its position.
+	 * @param id - id of the entity to remove.
+	 * @return pointer to the removed entity (to delete), nullptr if the store does not have it.
+	 */
+	T* remove(const std::string_view id) { return remove(Symbol_Table::get_instance().find(id)); }
+
+	// remove the entity of the handle of an id from the store (see remove(id)).
+	T* remove(const Symbol_Table::Handle handle) {
+		const auto it = m_index.find(handle);
+		if (it == m_index.end()) { return nullptr; }
+		const size_t position = it->second;
+		T* entity = m_entities[position];
+		m_index.erase(it);
+		if (position + 1 != m_entities.size()) {
+			m_entities[position] = m_entities.back();
+			m_handles[position] = m_handles.back();
+			m_index[m_handles[position]] = position;
+		}
+		m_entities.pop_back();
+		m_handles.pop_back();
+		Symbol_Table::get_instance().release(handle);
+		return entity;
+	}
+
+	// remove all entities from the store (without deleting them).
+	void clear() {
+		if (!m_handles.empty()) {
+			Symbol_Table& table = Symbol_Table::get_instance();
+			for (const Symbol_Table::Handle handle : m_handles) { table.release(handle); }
+		}
+		m_entities.clear();
+		m_handles.clear();
+		m_index.clear();
+	}
+};
+
+#endif // ENTITY_STORE_H
@@ -0,0 +1,190 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <cerrno>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CSV_Editor.h"
+#include "CSV_Writer.h"
+
+// Journal class represents an append only write ahead log of the catalog mutations.
+// each mutation (add or remove of Student, Teacher, Course, Lecture, Tutorial, Lab) is appended as one csv row:
+// op,type,course_id,fields...
+// op - 'A' for add or 'R' for remove.
+// type - file name of the entity type (T::get_file_name()).
+// course_id - id of the course of a course type (empty for main types).
+// fields - the csv row of the added entity (to_csv()) or the id of the removed entity.
+// the journal is replayed on top of the csv files on startup, and compacted back into them by Entity_Manager.
+class Journal {
+	int m_fd{-1}; // file descriptor of the journal file (opened on the first append).
+	size_t m_record_count{}; // number of records in the journal file.
+	bool m_dir_synced{false}; // flag to check if the entry of the open journal file is on disk.
+
+	// open the journal file for appending (if not already open).
+	void open_file() {
+		if (m_fd >= 0) { return; }
+		const std::string path = CSV_Editor::get_path(get_file_name());
+		m_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+		if (m_fd < 0) { throw std::runtime_error("Error: could not open file " + path); }
+		m_dir_synced = false; // the file may have been created.
+	}
+
+	// close the journal file (if open).
+	void close_file() {
+		if (m_fd >= 0) { close(m_fd); }
+		m_fd = -1;
+	}
+
+	// write the whole buffer to the file descriptor.
+	static void write_all(const int fd, const std::string& buffer, const std::string& path) {
+		size_t written{};
+		while (written < buffer.size()) {
+			const ssize_t count = write(fd, buffer.data() + written, buffer.size() - written);
+			if (count < 0) {
+				if (errno == EINTR) { continue; }
+				throw std::runtime_error("Error: could not write file " + path);
+			}
+			written += static_cast<size_t>(count);
+		}
+	}
+
+	// check if a file exists in the resources directory.
+	static bool file_exists(const std::string& file_name) {
+		struct stat file_stat{};
+		return stat(CSV_Editor::get_path(file_name).c_str(), &file_stat) == 0;
+	}
+
+public:
+	// constructor and destructor.
+	Journal() = default;
+	~Journal() { close_file(); }
+	// no copy since the journal owns the file descriptor.
+	Journal(const Journal&) = delete;
+	Journal& operator=(const Journal&) = delete;
+
+	// get the file name of the journal.
+	static std::string get_file_name() { return "journal.csv"; }
+	// get the file name of the journal while it is being compacted.
+	static std::string get_rotated_file_name() { return "journal_compacting.csv"; }
+
+	/**
+	 * append a record to the journal with a single write.
+	 * @param op - 'A' for add or 'R' for remove.
+	 * @param type - file name of the entity type (T::get_file_name()).
+	 * @param course_id - id of the course for course types, empty for main types.
+	 * @param fields - csv row of the added entity or the id of the removed entity.
+	 * @param durability - what the append waits for: none leaves the record in the page cache (lost on a power
+	 * failure, kept on a crash of the process), fsync_file waits for fdatasync of the journal, and fsync_file_and_dir
+	 * also syncs the directory once after the journal file was opened (it may have been created).
+	 */
+	void append(const char op, const std::string& type, const std::string& course_id,
+	            const std::vector<std::string>& fields,
+	            const CSV_Writer::Durability durability = CSV_Writer::Durability::none) {
+		open_file();
+		std::string record{op};
+		record += ',';
+		record += type;
+		record += ',';
+		record += course_id;
+		for (const std::string& field : fields) {
+			record += ',';
+			record += field;
+		}
+		record += '\n';
+		write_all(m_fd, record, get_file_name());
+		++m_record_count;
+		if (durability == CSV_Writer::Durability::none) { return; }
+		if (fdatasync(m_fd) < 0) { throw std::runtime_error("Error: could not sync file " + get_file_name()); }
+		if (durability == CSV_Writer::Durability::fsync_file_and_dir && !m_dir_synced) {
+			CSV_Writer::sync_dir();
+			m_dir_synced = true;
+		}
+	}
+
+	/**
+	 * replay the journal (a rotated journal left by an unfinished compaction first, then the journal).
+	 * @tparam Func - callable as func(const std::vector<std::string_view>& record).
+	 * @param func - function to call for each record.
+	 * @return number of records that were replayed.
+	 */
+	template <typename Func>
+	size_t replay(Func&& func) {
+		size_t count{};
+		auto on_record = [&](const std::vector<std::string_view>& record) {
+			++count;
+			func(record);
+		};
+		if (file_exists(get_rotated_file_name())) { CSV_Editor::stream_csv(get_rotated_file_name(), on_record); }
+		const size_t rotated_count = count;
+		if (file_exists(get_file_name())) { CSV_Editor::stream_csv(get_file_name(), on_record); }
+		m_record_count = count - rotated_count;
+		return count;
+	}
+
+	/**
+	 * move the journal aside before a compaction, new records go to a new journal file.
+	 * if a rotated journal was left by a failed compaction, the journal is appended to it instead.
+	 */
+	void rotate() {
+		close_file();
+		m_record_count = 0;
+		if (!file_exists(get_file_name())) { return; }
+		const std::string path = CSV_Editor::get_path(get_file_name());
+		const std::string rotated_path = CSV_Editor::get_path(get_rotated_file_name());
+		if (!file_exists(get_rotated_file_name())) {
+			if (std::rename(path.c_str(), rotated_path.c_str()) != 0) {
+				throw std::runtime_error("Error: could not rename file " + path);
+			}
+			return;
+		}
+		// keep the records of both journals, the csv files are not up to date with either of them.
+		std::string records{};
+		CSV_Editor::stream_csv(get_file_name(), [&](const std::vector<std::string_view>& record) {
+			for (size_t i = 0; i < record.size(); i++) {
+				if (i > 0) { records += ','; }
+				records += record[i];
+			}
+			records += '\n';
+		});
+		const int fd = open(rotated_path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+		if (fd < 0) { throw std::runtime_error("Error: could not open file " + rotated_path); }
+		try { write_all(fd, records, get_rotated_file_name()); }
+		catch (...) {
+			close(fd);
+			throw;
+		}
+		close(fd);
+		CSV_Editor::delete_csv(get_file_name());
+	}
+
+	// delete the rotated journal once its records were written to the csv files.
+	void remove_rotated() const {
+		if (file_exists(get_rotated_file_name())) { CSV_Editor::delete_csv(get_rotated_file_name()); }
+	}
+
+	// empty the journal once all of its records were written to the csv files.
+	void clear() {
+		m_record_count = 0;
+		if (m_fd >= 0) {
+			if (ftruncate(m_fd, 0) < 0) { throw std::runtime_error("Error: could not truncate the journal."); }
+			return;
+		}
+		const std::string path = CSV_Editor::get_path(get_file_name());
+		if (truncate(path.c_str(), 0) < 0 && errno != ENOENT) {
+			throw std::runtime_error("Error: could not truncate file " + path);
+		}
+	}
+
+	// get the number of records in the journal file.
+	size_t get_record_count() const { return m_record_count; }
+};
+
+#endif // JOURNAL_H
@@ -0,0 +1,98 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * Object Pool class allocates objects of type T in large slabs instead of one heap allocation per object.
+ * objects that are allocated one after another (like the rows of a csv file) are next to each other in memory,
+ * and freed slots are reused by the next allocation.
+ * used by the class specific operator new and operator delete of the entities (Student, Teacher, Course, Course_Type).
+ * note: allocate and deallocate are thread safe, since entities are created on the loading threads (see Thread_Pool).
+ * @tparam T - type of the objects (derived types with a larger size are allocated on the heap).
+ */
+template <typename T>
+class Object_Pool {
+	// a free slot holds the pointer to the next free slot.
+	struct Free_Slot {
+		Free_Slot* next{};
+	};
+
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Object_Pool does not support over aligned types.");
+	// size of a slot, large enough for T and a free slot, and a multiple of the alignment of T.
+	static constexpr size_t slot_size =
+		((sizeof(T) > sizeof(Free_Slot) ? sizeof(T) : sizeof(Free_Slot)) + alignof(T) - 1) / alignof(T) * alignof(T);
+	// number of slots in a slab (about 64KB).
+	static constexpr size_t slab_slots = 64 * 1024 / slot_size > 0 ? 64 * 1024 / slot_size : 1;
+
+	std::vector<char*> m_slabs{};
+	Free_Slot* m_free{}; // list of freed slots.
+	size_t m_used{slab_slots}; // number of slots of the last slab that were handed out.
+	std::mutex m_mutex{};
+
+	Object_Pool() = default;
+
+public:
+	// the slabs are released at once, after the catalog was destroyed (see get_instance()).
+	~Object_Pool() {
+		for (char* slab : m_slabs) { ::operator delete(slab); }
+	}
+	// no copy since the pool owns the slabs.
+	Object_Pool(const Object_Pool&) = delete;
+	Object_Pool& operator=(const Object_Pool&) = delete;
+
+	/*get the pool of type T.
+	note: created by the Entity_Manager constructor before it reads the catalog,
+	so it is destroyed after Entity_Manager and its entities.*/
+	static Object_Pool& get_instance() {
+		static Object_Pool pool;
+		return pool;
+	}
+
+	/**
+	 * allocate memory for an object.
+	 * @param size - size of the object (sizeof(T), or the size of a derived type).
+	 * @return pointer to the memory.
+	 */
+	void* allocate(const size_t size) {
+		if (size > slot_size) { return ::operator new(size); }
+		std::lock_guard<std::mutex> lock{m_mutex};
+		if (m_free) {
+			Free_Slot* slot = m_free;
+			m_free = slot->next;
+			return slot;
+		}
+		if (m_used == slab_slots) {
+			m_slabs.reserve(m_slabs.size() + 1); // so push_back can not throw after the allocation.
+			m_slabs.push_back(static_cast<char*>(::operator new(slot_size * slab_slots)));
+			m_used = 0;
+		}
+		return m_slabs.back() + slot_size * m_used++;
+	}
+
+	/**
+	 * free memory of an object allocated by allocate.
+	 * @param pointer - pointer to the memory.
+	 * @param size - size of the object (the same size that was allocated).
+	 */
+	void deallocate(void* pointer, const size_t size) {
+		if (!pointer) { return; }
+		if (size > slot_size) {
+			::operator delete(pointer);
+			return;
+		}
+		std::lock_guard<std::mutex> lock{m_mutex};
+		m_free = new(pointer) Free_Slot{m_free};
+	}
+
+	// get the number of slabs (for statistics).
+	size_t get_slab_count() {
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return m_slabs.size();
+	}
+};
+
+#endif // OBJECT_POOL_H
@@ -0,0 +1,133 @@
+#ifndef PREFIX_INDEX_H
+#define PREFIX_INDEX_H
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Symbol_Table.h"
+#include "data/Course.h"
+
+/**
+ * Prefix Index class keeps the ids, names and lecturer names of the courses sorted, to complete a typed prefix.
+ * a completion is a lower bound in the sorted set and a walk over the next entries,
+ * so it takes O(log n + limit) no matter how many courses there are.
+ * adding or removing a course changes three entries (O(log n)).
+ * note: the completions are case sensitive, like Search.
+ * the index holds a reference to the id of each course (see Symbol_Table), kept by its course id entry.
+ */
+class Prefix_Index {
+public:
+	// the course field a completion comes from.
+	enum class Field : uint8_t { course_id, course_name, lecturer };
+
+	// a completion of a prefix.
+	struct Completion {
+		std::string text{}; // the completed text.
+		Field field{};
+		std::string course_id{}; // id of a course that has the text.
+	};
+
+private:
+	// an entry of the index, sorted by text (then by field and course).
+	struct Entry {
+		std::string text{};
+		Field field{};
+		Symbol_Table::Handle course{}; // handle of the course id (see Symbol_Table).
+
+		bool operator<(const Entry& other) const {
+			if (text != other.text) { return text < other.text; }
+			if (field != other.field) { return field < other.field; }
+			return course < other.course;
+		}
+	};
+
+	// compare entries by text, so a prefix can be looked up without creating an entry.
+	struct Compare {
+		using is_transparent = void;
+		bool operator()(const Entry& first, const Entry& second) const { return first < second; }
+		bool operator()(const Entry& entry, const std::string_view text) const { return entry.text < text; }
+		bool operator()(const std::string_view text, const Entry& entry) const { return text < entry.text; }
+	};
+
+	std::set<Entry, Compare> m_entries{};
+
+	// helper function to get the entries of a course, with the handle of its id.
+	static std::vector<Entry> get_entries(const Course& course, const Symbol_Table::Handle handle) {
+		return {
+			{std::string{course.get_id_view()}, Field::course_id, handle},
+			{std::string{course.get_name_view()}, Field::course_name, handle},
+			{std::string{course.get_lecturer_view()}, Field::lecturer, handle}
+		};
+	}
+
+public:
+	Prefix_Index() = default;
+	// no copy since the index holds a reference to the id of each course.
+	Prefix_Index(const Prefix_Index&) = delete;
+	Prefix_Index& operator=(const Prefix_Index&) = delete;
+	~Prefix_Index() { clear(); }
+
+	// get the number of entries (three per course).
+	size_t size() const { return m_entries.size(); }
+
+	// add the id, name and lecturer of a course.
+	void add(const Course& course) {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.intern(course.get_id_view());
+		bool added{false};
+		for (Entry& entry : get_entries(course, handle)) {
+			const bool is_id = entry.field == Field::course_id;
+			if (m_entries.insert(std::move(entry)).second && is_id) { added = true; }
+		}
+		if (!added) { table.release(handle); } // the course id entry already holds a reference.
+	}
+
+	// remove the id, name and lecturer of a course (the course must not have changed since it was added).
+	void remove(const Course& course) {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.find(course.get_id_view());
+		if (handle == Symbol_Table::no_handle) { return; }
+		bool removed{false};
+		for (const Entry& entry : get_entries(course, handle)) {
+			if (m_entries.erase(entry) > 0 && entry.field == Field::course_id) { removed = true; }
+		}
+		if (removed) { table.release(handle); }
+	}
+
+	// remove all entries.
+	void clear() {
+		if (!m_entries.empty()) {
+			Symbol_Table& table = Symbol_Table::get_instance();
+			for (const Entry& entry : m_entries) {
+				if (entry.field == Field::course_id) { table.release(entry.course); }
+			}
+		}
+		m_entries.clear();
+	}
+
+	/**
+	 * complete a prefix with the course ids, names and lecturer names that start with it, sorted by text.
+	 * a lecturer of a few courses is completed once.
+	 * @param prefix - the typed prefix.
+	 * @param limit - maximum number of completions.
+	 * @return the completions.
+	 */
+	std::vector<Completion> complete(const std::string_view prefix, const size_t limit) const {
+		std::vector<Completion> completions{};
+		const Symbol_Table& table = Symbol_Table::get_instance();
+		auto it = m_entries.lower_bound(prefix);
+		while (it != m_entries.end() && completions.size() < limit) {
+			if (it->text.compare(0, prefix.size(), prefix) != 0) { break; } // past the entries with the prefix.
+			completions.push_back({it->text, it->field, table.get_id(it->course)});
+			// the lecturer entries are the last ones of a text, skip the other courses of the lecturer at once.
+			if (it->field == Field::lecturer) { it = m_entries.upper_bound(std::string_view{it->text}); }
+			else { ++it; }
+		}
+		return completions;
+	}
+};
+
+#endif // PREFIX_INDEX_H
@@ -0,0 +1,179 @@
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Symbol_Table.h"
+#include "data/Course.h"
+
+/**
+ * Search Index class is an inverted index over the csv cells of the entities of type T (Student, Teacher, Course).
+ * every substring of 1 to 3 characters (gram) of a cell maps to the ids of the entities that have it,
+ * so a search only looks at the entities that have the rarest gram of the text instead of at every entity.
+ * the candidates are checked with Entity::search, so the matches are exactly the ones of a linear search.
+ * a course is indexed with the cells of its course types too, since Course::search also searches them.
+ * note: a removed entity stays in the posting lists until they are rebuilt,
+ * the stale ids are dropped by the check (they are not documents anymore).
+ * the index holds a reference to the id of each document (see Symbol_Table), not to the stale ids of the postings,
+ * so a stale handle can be reused by a new id, which the check filters like any other candidate.
+ * @tparam T - type of the entities.
+ */
+template <typename T>
+class Search_Index {
+	// a gram packed with its length: length << 24 | first char << 16 | second char << 8 | third char.
+	using Gram = uint32_t;
+	static constexpr size_t max_gram_size = 3;
+	// minimum number of removed entities before the posting lists are rebuilt.
+	static constexpr size_t min_rebuild = 1024;
+
+	// keys - grams, values - handles of the ids of the entities that have the gram (may have stale ids).
+	std::unordered_map<Gram, std::vector<Symbol_Table::Handle>> m_postings{};
+	// the indexed entities, keys - handles of the ids, values - the entities.
+	std::unordered_map<Symbol_Table::Handle, const T*> m_documents{};
+	size_t m_removed_count{}; // number of entities removed since the posting lists were built.
+
+	// helper function to pack a gram of text.
+	static Gram make_gram(const std::string_view text) {
+		Gram gram = static_cast<Gram>(text.size()) << 24;
+		for (size_t i = 0; i < text.size(); i++) {
+			gram |= static_cast<Gram>(static_cast<unsigned char>(text[i])) << (16 - 8 * i);
+		}
+		return gram;
+	}
+
+	// helper function to add the grams of a cell.
+	static void add_cell_grams(const std::string_view cell, std::vector<Gram>& grams) {
+		for (size_t pos = 0; pos < cell.size(); pos++) {
+			for (size_t size = 1; size <= max_gram_size && pos + size <= cell.size(); size++) {
+				grams.push_back(make_gram(cell.substr(pos, size)));
+			}
+		}
+	}
+
+	// helper function to get the distinct grams of the searchable cells of an entity (see Entity::search).
+	static std::vector<Gram> get_grams(const T& entity) {
+		std::vector<Gram> grams{};
+		for (const std::string& cell : entity.to_csv()) { add_cell_grams(cell, grams); }
+		if constexpr (std::is_same_v<T, Course>) {
+			entity.for_each_course_type([&grams](const Course_Type& course_type) {
+				for (const std::string& cell : course_type.to_csv()) { add_cell_grams(cell, grams); }
+			});
+		}
+		std::sort(grams.begin(), grams.end());
+		grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+		return grams;
+	}
+
+	// helper function to add the handle of an entity to the posting lists of its grams.
+	void add_postings(const Symbol_Table::Handle handle, const T& entity) {
+		for (const Gram gram : get_grams(entity)) { m_postings[gram].push_back(handle); }
+	}
+
+	// rebuild the posting lists from the indexed entities, drops the stale ids.
+	void rebuild() {
+		m_postings.clear();
+		for (const auto& [handle, entity] : m_documents) { add_postings(handle, *entity); }
+		m_removed_count = 0;
+	}
+
+	// helper function to get the posting list of the rarest gram of text, nullptr if some gram is not indexed.
+	const std::vector<Symbol_Table::Handle>* find_postings(const std::string_view text) const {
+		const size_t size = std::min(text.size(), max_gram_size);
+		const std::vector<Symbol_Table::Handle>* rarest{};
+		for (size_t pos = 0; pos + size <= text.size(); pos++) {
+			const auto it = m_postings.find(make_gram(text.substr(pos, size)));
+			if (it == m_postings.end()) { return nullptr; }
+			if (!rarest || it->second.size() < rarest->size()) { rarest = &it->second; }
+		}
+		return rarest;
+	}
+
+public:
+	Search_Index() = default;
+	// no copy since the index holds a reference to the id of each document.
+	Search_Index(const Search_Index&) = delete;
+	Search_Index& operator=(const Search_Index&) = delete;
+	~Search_Index() { clear(); }
+
+	// get the number of indexed entities.
+	size_t size() const { return m_documents.size(); }
+
+	/**
+	 * add an entity to the index (or index it again if it has the same id as an indexed entity).
+	 * @param entity - pointer to the entity to index (not null, must be removed before it is deleted).
+	 */
+	void add(const T* entity) {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.intern(entity->get_id_view());
+		// an entity with the same id is replaced, the index already holds a reference to the id.
+		if (!m_documents.insert_or_assign(handle, entity).second) { table.release(handle); }
+		add_postings(handle, *entity);
+	}
+
+	/**
+	 * remove an entity from the index.
+	 * @param id - id of the entity to remove.
+	 */
+	void remove(const std::string_view id) { remove(Symbol_Table::get_instance().find(id)); }
+
+	// remove the entity of the handle of an id from the index (see remove(id)).
+	void remove(const Symbol_Table::Handle handle) {
+		if (m_documents.erase(handle) == 0) { return; }
+		Symbol_Table::get_instance().release(handle);
+		if (++m_removed_count >= min_rebuild && m_removed_count >= m_documents.size()) { rebuild(); }
+	}
+
+	// index an entity again after its searchable cells changed (like the course types of a course).
+	void update(const T* entity) {
+		remove(entity->get_id_view());
+		add(entity);
+	}
+
+	// remove all entities from the index.
+	void clear() {
+		if (!m_documents.empty()) {
+			Symbol_Table& table = Symbol_Table::get_instance();
+			for (const auto& [handle, entity] : m_documents) { table.release(handle); }
+		}
+		m_postings.clear();
+		m_documents.clear();
+		m_removed_count = 0;
+	}
+
+	/**
+	 * find the entities that have text in one of their cells (the same matches as Entity::search).
+	 * @param text - the text to search for.
+	 * @return handles of the ids and the matching entities (in no particular order).
+	 */
+	std::vector<std::pair<Symbol_Table::Handle, const T*>> search(const std::string& text) const {
+		std::vector<std::pair<Symbol_Table::Handle, const T*>> matches{};
+		if (text.empty()) {
+			// every cell has the empty text, so every entity with a cell matches.
+			for (const auto& [handle, entity] : m_documents) {
+				if (entity->search(text)) { matches.emplace_back(handle, entity); }
+			}
+			return matches;
+		}
+		const std::vector<Symbol_Table::Handle>* postings = find_postings(text);
+		if (!postings) { return matches; }
+		std::vector<Symbol_Table::Handle> candidates{*postings};
+		// an entity that was removed and added again can be in the posting list twice.
+		std::sort(candidates.begin(), candidates.end());
+		candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+		for (const Symbol_Table::Handle handle : candidates) {
+			const auto it = m_documents.find(handle);
+			// skip stale ids, and check the whole text in a single cell.
+			if (it != m_documents.end() && it->second->search(text)) { matches.emplace_back(handle, it->second); }
+		}
+		return matches;
+	}
+};
+
+#endif // SEARCH_INDEX_H
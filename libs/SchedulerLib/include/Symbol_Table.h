@@ -0,0 +1,187 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Symbol Table class interns ids (course ids, group ids, student and teacher ids) into 32 bit handles.
+ * each distinct id is stored once, and the maps that are keyed by ids (Entity_Order, Entity_Store, Course)
+ * key on the handle instead of a copy of the id, so their lookups hash a uint32 instead of a string.
+ * every intern() holds a reference to the id, which is given back with release(), an id without references is
+ * removed and its handle is reused by the next new id (so the table does not grow with the removed ids).
+ * note: thread safe, ids can be interned while other threads look up handles.
+ * the ids are split into stripes by their hash, each with its own lock, so a lookup only takes the lock of the stripe
+ * of its id (in shared mode) and lookups of different ids rarely share a lock (or the cache line of its counter).
+ */
+class Symbol_Table {
+public:
+	using Handle = uint32_t;
+	// returned by find() for an id that was never interned.
+	static constexpr Handle no_handle = UINT32_MAX;
+
+private:
+	// an interned id with the number of references to it (a free slot has no references).
+	struct Symbol {
+		std::string id{};
+		size_t references{};
+	};
+
+	// number of stripes (a power of two), the low bits of a handle are its stripe and the rest its position in it.
+	static constexpr unsigned stripe_bits = 6;
+	static constexpr Handle stripe_count = Handle{1} << stripe_bits;
+
+	// the ids of a stripe, on their own cache line so the locks of the stripes do not share one.
+	struct alignas(64) Stripe {
+		// the interned ids, a deque so the ids do not move when one is added (the keys of handles view them).
+		std::deque<Symbol> symbols{};
+		// keys - views of the ids in symbols, values - handles.
+		std::unordered_map<std::string_view, Handle> handles{};
+		std::vector<Handle> free{}; // handles of the removed ids, reused by the next new ids of the stripe.
+		mutable std::shared_mutex mutex{};
+	};
+
+	std::array<Stripe, stripe_count> m_stripes{};
+
+	Symbol_Table() = default;
+
+	// get the stripe of an id (by the high bits of its hash, the maps of the stripes bucket by the low bits).
+	Stripe& get_stripe(const std::string_view id) {
+		const size_t hash = std::hash<std::string_view>{}(id);
+		return m_stripes[hash >> (sizeof(size_t) * 8 - stripe_bits)];
+	}
+	const Stripe& get_stripe(const std::string_view id) const {
+		return const_cast<Symbol_Table*>(this)->get_stripe(id);
+	}
+
+	// get the stripe of a handle.
+	Stripe& get_stripe(const Handle handle) { return m_stripes[handle & (stripe_count - 1)]; }
+
+	// helper function to get the symbol of a handle that has references (the caller holds the lock of its stripe).
+	static Symbol& get_symbol(Stripe& stripe, const Handle handle) {
+		const size_t position = handle >> stripe_bits;
+		if (handle == no_handle || position >= stripe.symbols.size() || stripe.symbols[position].references == 0) {
+			throw std::invalid_argument("Invalid symbol handle.");
+		}
+		return stripe.symbols[position];
+	}
+
+public:
+	// no copy since the handles are only valid in the one table.
+	Symbol_Table(const Symbol_Table&) = delete;
+	Symbol_Table& operator=(const Symbol_Table&) = delete;
+
+	/*get the only instance of the table.
+	note: created by the Entity_Manager constructor before it reads the catalog,
+	so it is destroyed after Entity_Manager and the orders that refer to its ids.*/
+	static Symbol_Table& get_instance() {
+		static Symbol_Table table;
+		return table;
+	}
+
+	/**
+	 * get the handle of an id and hold a reference to it, the id is added to the table if it is new.
+	 * note: every intern() is paired with a release() of the handle.
+	 * @param id - the id to intern.
+	 * @return the handle of the id.
+	 */
+	Handle intern(const std::string_view id) {
+		Stripe& stripe = get_stripe(id);
+		std::unique_lock<std::shared_mutex> lock{stripe.mutex};
+		const auto it = stripe.handles.find(id);
+		if (it != stripe.handles.end()) {
+			++get_symbol(stripe, it->second).references;
+			return it->second;
+		}
+		Handle handle{};
+		if (!stripe.free.empty()) {
+			handle = stripe.free.back();
+			stripe.free.pop_back();
+			stripe.symbols[handle >> stripe_bits].id = id;
+		}
+		else {
+			// the last position of the last stripe would be no_handle.
+			if (stripe.symbols.size() >= (no_handle >> stripe_bits)) {
+				throw std::runtime_error("Error: too many ids in the symbol table.");
+			}
+			const auto stripe_index = static_cast<Handle>(&stripe - m_stripes.data());
+			handle = static_cast<Handle>(stripe.symbols.size() << stripe_bits) | stripe_index;
+			stripe.symbols.push_back({std::string{id}, 0});
+		}
+		Symbol& symbol = stripe.symbols[handle >> stripe_bits];
+		symbol.references = 1;
+		stripe.handles.emplace(symbol.id, handle);
+		return handle;
+	}
+
+	/**
+	 * hold another reference to an interned id (like intern() of its id, without hashing it).
+	 * @param handle - handle returned by intern(), that still has a reference.
+	 * @return the handle.
+	 */
+	Handle acquire(const Handle handle) {
+		Stripe& stripe = get_stripe(handle);
+		std::unique_lock<std::shared_mutex> lock{stripe.mutex};
+		++get_symbol(stripe, handle).references;
+		return handle;
+	}
+
+	/**
+	 * give back a reference to an id, the id is removed once it has no references.
+	 * @param handle - handle returned by intern() or acquire().
+	 */
+	void release(const Handle handle) {
+		Stripe& stripe = get_stripe(handle);
+		std::unique_lock<std::shared_mutex> lock{stripe.mutex};
+		Symbol& symbol = get_symbol(stripe, handle);
+		if (--symbol.references > 0) { return; }
+		stripe.handles.erase(symbol.id);
+		std::string{}.swap(symbol.id);
+		stripe.free.push_back(handle);
+	}
+
+	/**
+	 * get the handle of an id without adding it.
+	 * @param id - the id to find.
+	 * @return the handle of the id, no_handle if it was never interned.
+	 */
+	Handle find(const std::string_view id) const {
+		const Stripe& stripe = get_stripe(id);
+		std::shared_lock<std::shared_mutex> lock{stripe.mutex};
+		const auto it = stripe.handles.find(id);
+		return it != stripe.handles.end() ? it->second : no_handle;
+	}
+
+	/**
+	 * get the id of a handle.
+	 * note: the reference stays valid until the last reference to the handle is released.
+	 * @param handle - handle returned by intern().
+	 * @return the interned id.
+	 */
+	const std::string& get_id(const Handle handle) const {
+		Stripe& stripe = const_cast<Symbol_Table*>(this)->get_stripe(handle);
+		std::shared_lock<std::shared_mutex> lock{stripe.mutex};
+		return get_symbol(stripe, handle).id;
+	}
+
+	// get the number of interned ids (for statistics).
+	size_t size() const {
+		size_t size{};
+		for (const Stripe& stripe : m_stripes) {
+			std::shared_lock<std::shared_mutex> lock{stripe.mutex};
+			size += stripe.handles.size();
+		}
+		return size;
+	}
+};
+
+#endif // SYMBOL_TABLE_H
@@ -1,6 +1,7 @@
 #ifndef SYSTEM_OPERATIONS_H
 #define SYSTEM_OPERATIONS_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -12,13 +13,22 @@
 
 // System Operations is a static utility class to perform operations on the csv files data.
 // it does this by using the Entity Manager to manage the entities and Schedule Manager to manage the schedules.
+// note: the operations do not lock the catalog, the session that calls them holds the lock of the Entity Manager
+// for the whole command (see Entity_Manager::read_lock() and Entity_Manager::write_lock()),
+// except the listings, which print a pinned version of the catalog without the lock (see Catalog_Version).
 class System_Operations {
-	// static member to keep track of the curr course index.
-	static size_t curr_course_index;
-
-	// static memeber to keep track of the curr Schedule_Manager instace for a student.
-	static Student* curr_student;
+public:
+	/*position of a session in a paged listing of courses, lecturers or students, continued by print_more().
+	each session (User) keeps its own cursor, and the cursor is a position in the order of the listed type
+	(see Entity_Order::Cursor), so adding or removing entities does not skip or repeat entities on the next page.*/
+	struct Page_Cursor {
+		enum class Listing : uint8_t { none, courses, teachers, students };
+		Listing listing{Listing::none};
+		Entity_Order::Cursor position{};
+		size_t count{}; // number of entities per page.
+	};
 
+private:
 	// private constructor and destructor to prevent instantiation.
 	System_Operations() = default;
 	~System_Operations() = default;
@@ -34,16 +44,83 @@ class System_Operations {
 		}
 	}
 
+	// start a paged listing of main type T and print its first page.
+	template <typename T>
+	static bool print_first_page(Page_Cursor& cursor, const Page_Cursor::Listing listing, const size_t count) {
+		cursor = {listing, {}, count};
+		return print_next_page<T>(cursor);
+	}
+
+	// print all entities of main type T from a pinned version (a long print does not wait for the write commands).
+	template <typename T>
+	static bool print_all(const std::string& kind) {
+		try {
+			Entity_Manager::get_instance().pin_version()->print_entities<T>();
+			return true;
+		}
+		catch (const std::exception& e) {
+			std::cerr << "Error printing all " << kind << ": " << e.what() << std::endl;
+			return false;
+		}
+	}
+
+	// print the next page of a listing of main type T.
+	template <typename T>
+	static bool print_next_page(Page_Cursor& cursor) {
+		const std::string kind{get_listing_name(cursor.listing)};
+		try {
+			// the page is printed from a pinned version, so it does not wait for the write commands.
+			const std::shared_ptr<const Catalog_Version> version{Entity_Manager::get_instance().pin_version()};
+			if (version->print_page<T>(cursor.position, cursor.count) == 0) {
+				std::cout << "No more " << kind << " to print." << std::endl;
+				return false;
+			}
+			return true;
+		}
+		catch (const std::exception& e) {
+			std::cerr << "Error printing " << kind << ": " << e.what() << std::endl;
+			return false;
+		}
+	}
+
+	// get the name of the listed entities (for messages).
+	static const char* get_listing_name(const Page_Cursor::Listing listing) {
+		switch (listing) {
+		case Page_Cursor::Listing::courses: return "courses";
+		case Page_Cursor::Listing::teachers: return "lecturers";
+		case Page_Cursor::Listing::students: return "students";
+		default: return "entities";
+		}
+	}
+
 public:
 	// course operations.
 	// print a course by id.
 	static bool print_course(const std::string& id);
-	// print the first count courses, if reset index is true, reset the index to 0.
-	static bool print_courses(size_t count = 10, bool reset_index = true);
-	// print the next count courses.
-	static bool print_more_courses(size_t count = 10);
+	// print the first count courses, and start a course listing of the session (continued by print_more()).
+	static bool print_courses(Page_Cursor& cursor, const size_t count = 10) {
+		std::cout << "Printing courses:" << std::endl;
+		return print_first_page<Course>(cursor, Page_Cursor::Listing::courses, count);
+	}
+
+	/**
+	 * print the next page of the listing of a session (courses, lecturers or students).
+	 * O(log n + page size) however many pages were printed before (see Entity_Manager::print_page()).
+	 * @param cursor - the listing of the session, moved to after the printed page.
+	 * @return true if any entity was printed, false if the listing is done (or was not started).
+	 */
+	static bool print_more(Page_Cursor& cursor) {
+		switch (cursor.listing) {
+		case Page_Cursor::Listing::courses: return print_next_page<Course>(cursor);
+		case Page_Cursor::Listing::teachers: return print_next_page<Teacher>(cursor);
+		case Page_Cursor::Listing::students: return print_next_page<Student>(cursor);
+		default:
+			std::cout << "Nothing to continue, print courses, lecturers or students first." << std::endl;
+			return false;
+		}
+	}
 	// print all courses.
-	static bool print_all_courses();
+	static bool print_all_courses() { return print_all<Course>("courses"); }
 
 	// add and remove a course.
 	static bool add_course(const std::string& id, const std::string& name, const std::string& lecturer,
@@ -60,8 +137,8 @@ public:
 		try {
 			// create a new lecture course type.
 			course_type = new T(group_id, m_day, m_start_time, std::stol(m_duration), m_lecturer, m_classroom);
-			// get the course entity and downcast it to the Course type.
-			Course* course = dynamic_cast<Course*>(Entity_Manager::get_instance().get_entity(course_id));
+			// get the course entity from the course store.
+			Course* course = Entity_Manager::get_instance().get_entity<Course>(course_id);
 			// check if course exists in entity manager.
 			if (!course) { throw std::invalid_argument("Course with id: " + course_id + " does not exist."); }
 			// add the course type to the course.
@@ -79,8 +156,8 @@ public:
 	template <typename T>
 	static bool rm_course_type(const std::string& course_id, const std::string& group_id) {
 		try {
-			// get the course entity and downcast it to the Course type.
-			Entity* course = dynamic_cast<Course*>(Entity_Manager::get_instance().get_entity(course_id));
+			// get the course entity from the course store.
+			Course* course = Entity_Manager::get_instance().get_entity<Course>(course_id);
 			// check if course exists in entity manager.
 			if (!course) { throw std::invalid_argument("Course with id: " + course_id + " does not exist."); }
 			// remove the course type from the course.
@@ -97,7 +174,11 @@ public:
 	// print a teacher by id.
 	static bool print_teacher(const std::string& id);
 	// print all teachers.
-	static bool print_all_teachers();
+	static bool print_all_teachers() { return print_all<Teacher>("teachers"); }
+	// print the first count teachers, and start a lecturer listing of the session (continued by print_more()).
+	static bool print_teachers(Page_Cursor& cursor, const size_t count) {
+		return print_first_page<Teacher>(cursor, Page_Cursor::Listing::teachers, count);
+	}
 	// add and remove a teacher.
 	static bool add_lecturer(const std::string& id, const std::string& name);
 	static bool rm_lecturer(const std::string& id);
@@ -106,14 +187,99 @@ public:
 	// print a student by id.
 	static bool print_student(const std::string& id);
 	// print all students.
-	static bool print_all_students();
+	static bool print_all_students() { return print_all<Student>("students"); }
+	// print the first count students, and start a student listing of the session (continued by print_more()).
+	static bool print_students(Page_Cursor& cursor, const size_t count) {
+		return print_first_page<Student>(cursor, Page_Cursor::Listing::students, count);
+	}
 	// add and remove a student.
 	static bool add_student(const std::string& id, const std::string& name, const std::string& password);
 	static bool rm_student(const std::string& id);
 
 	// search for text in all entities (courses, teachers, students, etc).
+	// note: each type is searched through its search index (see Entity_Manager::search_entites()).
 	static bool search(const std::string& text);
 
+	/**
+	 * print the course ids, course names and lecturer names that start with a prefix.
+	 * @param prefix - the typed prefix.
+	 * @param limit - maximum number of completions.
+	 * @return true if any completion was found, false otherwise.
+	 */
+	static bool complete(const std::string& prefix, const size_t limit = 10) {
+		const std::vector<Prefix_Index::Completion> completions{
+			Entity_Manager::get_instance().complete(prefix, limit)
+		};
+		if (completions.empty()) {
+			std::cout << "No completions found for: " << prefix << std::endl;
+			return false;
+		}
+		for (const Prefix_Index::Completion& completion : completions) {
+			std::cout << completion.text;
+			switch (completion.field) {
+			case Prefix_Index::Field::course_id: std::cout << " - course id"; break;
+			case Prefix_Index::Field::course_name: std::cout << " - course name (" << completion.course_id << ")"; break;
+			case Prefix_Index::Field::lecturer: std::cout << " - lecturer"; break;
+			}
+			std::cout << std::endl;
+		}
+		return true;
+	}
+
+	// complete a prefix with a limit given as text (from the command line).
+	static bool complete(const std::string& prefix, const std::string& limit) {
+		try {
+			const long count = std::stol(limit);
+			if (count <= 0) { throw std::invalid_argument("limit must be positive"); }
+			return complete(prefix, static_cast<size_t>(count));
+		}
+		catch (const std::exception&) {
+			std::cerr << "Error: invalid limit: " << limit << std::endl;
+			return false;
+		}
+	}
+
+	/**
+	 * print the course types of all courses that match a query, with their course ids.
+	 * example: print_course_types({"Monday", "A101"}) to print what runs in classroom A101 on Monday.
+	 * @param query - the fields to match (day, classroom, lecturer, start hour), see Course_Type_Index.
+	 * @return true if any course type was found, false otherwise.
+	 */
+	static bool print_course_types(const Course_Type_Index::Query& query) {
+		const std::vector<Course_Type_Index::Match> matches{Entity_Manager::get_instance().find_course_types(query)};
+		if (matches.empty()) {
+			std::cout << "No course types found." << std::endl;
+			return false;
+		}
+		for (const Course_Type_Index::Match& match : matches) {
+			std::cout << "Course " << match.course->get_id_view() << ": " << *match.course_type << std::endl;
+		}
+		return true;
+	}
+
+	// print the course types in a classroom (on a day, or on every day if day is empty).
+	static bool print_classroom_course_types(const std::string& classroom, const std::string& day = "") {
+		return print_course_types({day, classroom, "", -1});
+	}
+
+	// print the course types a lecturer teaches.
+	static bool print_lecturer_course_types(const std::string& lecturer) {
+		return print_course_types({"", "", lecturer, -1});
+	}
+
+	// print the course types that start at an hour (0 - 23) on a day.
+	static bool print_course_types_at(const std::string& day, const int start_hour) {
+		return print_course_types({day, "", "", start_hour});
+	}
+
+	// write the modified csv files and the catalog snapshot.
+	// called between commands (not by a session command), so it takes the write lock itself.
+	static void checkpoint() {
+		Entity_Manager& manager = Entity_Manager::get_instance();
+		const Entity_Manager::Write_Lock lock{manager.write_lock()};
+		manager.checkpoint();
+	}
+
 	// authenticate a student by id and password (returns true if student exists in record).
 	static bool authenticate_student(const std::string& id, const std::string& password);
 	// get a pointer to the student schedule manager by id.
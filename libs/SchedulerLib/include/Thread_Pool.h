@@ -0,0 +1,88 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Thread Pool class represents a fixed number of worker threads that run submitted tasks in order.
+// the workers are started on the first submit, so a pool that is never used does not create threads.
+// the destructor drops the tasks that did not start yet and waits for the running tasks.
+class Thread_Pool {
+	size_t m_size{}; // number of worker threads.
+	std::vector<std::thread> m_workers{};
+	std::deque<std::function<void()>> m_tasks{}; // tasks that did not start yet.
+	std::mutex m_mutex{}; // guards m_tasks and m_stopping.
+	std::condition_variable m_condition{};
+	bool m_stopping{false};
+
+	// worker thread loop, runs tasks until the pool is destroyed.
+	void work() {
+		while (true) {
+			std::function<void()> task{};
+			{
+				std::unique_lock<std::mutex> lock{m_mutex};
+				m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+				if (m_stopping) { return; }
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+			task(); // exceptions are stored in the future of the task (see submit()).
+		}
+	}
+
+public:
+	/**
+	 * constructor.
+	 * @param size - number of worker threads, 0 for the number of hardware threads.
+	 */
+	explicit Thread_Pool(const size_t size = 0) :
+		m_size{size > 0 ? size : std::max<size_t>(1, std::thread::hardware_concurrency())} {}
+	~Thread_Pool() {
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			m_stopping = true;
+			m_tasks.clear(); // the futures of the dropped tasks get a broken promise.
+		}
+		m_condition.notify_all();
+		for (std::thread& worker : m_workers) { worker.join(); }
+	}
+	// no copy since the workers hold a pointer to the pool.
+	Thread_Pool(const Thread_Pool&) = delete;
+	Thread_Pool& operator=(const Thread_Pool&) = delete;
+
+	/**
+	 * run a task on a worker thread.
+	 * @tparam Func - callable with no arguments.
+	 * @param func - the task.
+	 * @return future with the result (or the exception) of the task.
+	 */
+	template <typename Func>
+	std::future<std::invoke_result_t<Func>> submit(Func&& func) {
+		using Result = std::invoke_result_t<Func>;
+		// std::function has to be copyable, so the packaged task is shared.
+		auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+		std::future<Result> result = task->get_future();
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			if (m_workers.empty()) {
+				for (size_t i = 0; i < m_size; i++) { m_workers.emplace_back(&Thread_Pool::work, this); }
+			}
+			m_tasks.emplace_back([task] { (*task)(); });
+		}
+		m_condition.notify_one();
+		return result;
+	}
+
+	// get the number of worker threads.
+	size_t get_size() const { return m_size; }
+};
+
+#endif // THREAD_POOL_H
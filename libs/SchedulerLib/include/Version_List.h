@@ -0,0 +1,171 @@
+#ifndef VERSION_LIST_H
+#define VERSION_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "Entity_Order.h"
+
+/**
+ * Version List class is the list of the entities of type T of one catalog version (see Catalog_Version),
+ * in the order of their Entity_Order, each with the cursor of its id.
+ * the entities are kept in chunks that are shared between versions: a copy of the list copies the pointers to
+ * the chunks, and a change copies the one chunk it changes (copy on write), so a version costs its changed chunk
+ * and the pointers to the chunks, not a copy of the whole list.
+ * note: the list does not own the entities, and a chunk that is shared with a published version is never changed.
+ * @tparam T - type of the entities (Student, Teacher, Course).
+ */
+template <typename T>
+class Version_List {
+public:
+	// an entity of the list with the cursor of its id in the Entity_Order of T.
+	struct Item {
+		Entity_Order::Cursor cursor{};
+		const T* entity{};
+	};
+
+private:
+	using Chunk = std::vector<Item>;
+	// maximum number of items in a chunk.
+	static constexpr size_t chunk_size = 256;
+
+	// the chunks in order (none is empty), shared with the other versions.
+	std::vector<std::shared_ptr<Chunk>> m_chunks{};
+	size_t m_size{};
+
+	// helper function to get the position of the first chunk whose last item is not before a cursor.
+	size_t find_chunk(const Entity_Order::Cursor& cursor) const {
+		const auto it = std::partition_point(m_chunks.begin(), m_chunks.end(),
+		                                     [&cursor](const std::shared_ptr<Chunk>& chunk) {
+			                                     return chunk->back().cursor < cursor;
+		                                     });
+		return static_cast<size_t>(it - m_chunks.begin());
+	}
+
+	// helper function to get the position of the item of a cursor in a chunk (or where it would be).
+	static typename Chunk::iterator find_item(Chunk& chunk, const Entity_Order::Cursor& cursor) {
+		return std::lower_bound(chunk.begin(), chunk.end(), cursor,
+		                        [](const Item& item, const Entity_Order::Cursor& key) { return item.cursor < key; });
+	}
+
+	// helper function to get a chunk that only this list has, copied first if a version shares it.
+	// note: a chunk is only shared by copies of the list, which are made by the writing thread.
+	Chunk& get_own_chunk(const size_t position) {
+		std::shared_ptr<Chunk>& chunk = m_chunks[position];
+		if (chunk.use_count() > 1) { chunk = std::make_shared<Chunk>(*chunk); }
+		return *chunk;
+	}
+
+public:
+	// forward iterator over the items in order.
+	class const_iterator {
+		const std::vector<std::shared_ptr<Chunk>>* m_chunks{};
+		size_t m_chunk{};
+		size_t m_item{};
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Item;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Item*;
+		using reference = const Item&;
+
+		const_iterator() = default;
+		const_iterator(const std::vector<std::shared_ptr<Chunk>>* chunks, const size_t chunk, const size_t item)
+			: m_chunks{chunks}, m_chunk{chunk}, m_item{item} {}
+
+		reference operator*() const { return (*(*m_chunks)[m_chunk])[m_item]; }
+		pointer operator->() const { return &**this; }
+
+		const_iterator& operator++() {
+			if (++m_item == (*m_chunks)[m_chunk]->size()) {
+				++m_chunk;
+				m_item = 0;
+			}
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator copy{*this};
+			++*this;
+			return copy;
+		}
+
+		bool operator==(const const_iterator& other) const {
+			return m_chunk == other.m_chunk && m_item == other.m_item;
+		}
+		bool operator!=(const const_iterator& other) const { return !(*this == other); }
+	};
+
+	const_iterator begin() const { return {&m_chunks, 0, 0}; }
+	const_iterator end() const { return {&m_chunks, m_chunks.size(), 0}; }
+
+	// get the number of entities.
+	size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+	/**
+	 * get the first item at or after a cursor, O(log n).
+	 * @param cursor - a cursor of the Entity_Order of T.
+	 * @return iterator to the item, end() if there are no items after the cursor.
+	 */
+	const_iterator seek(const Entity_Order::Cursor& cursor) const {
+		const size_t position = find_chunk(cursor);
+		if (position == m_chunks.size()) { return end(); }
+		Chunk& chunk = *m_chunks[position];
+		return {&m_chunks, position, static_cast<size_t>(find_item(chunk, cursor) - chunk.begin())};
+	}
+
+	/**
+	 * add an entity after the last one.
+	 * @param cursor - cursor of the id of the entity, after the cursors of the entities in the list.
+	 * @param entity - the entity.
+	 */
+	void push_back(const Entity_Order::Cursor& cursor, const T* entity) {
+		if (m_chunks.empty() || m_chunks.back()->size() >= chunk_size) {
+			m_chunks.push_back(std::make_shared<Chunk>());
+			m_chunks.back()->reserve(chunk_size);
+		}
+		get_own_chunk(m_chunks.size() - 1).push_back({cursor, entity});
+		++m_size;
+	}
+
+	/**
+	 * replace the entity of a cursor (with a copy of it, see Entity_Manager::get_writable_course()).
+	 * @param cursor - cursor of the id of the entity.
+	 * @param entity - the new entity.
+	 * @return true if the entity was replaced, false if the list does not have the cursor.
+	 */
+	bool replace(const Entity_Order::Cursor& cursor, const T* entity) {
+		const size_t position = find_chunk(cursor);
+		if (position == m_chunks.size()) { return false; }
+		Chunk& chunk = get_own_chunk(position);
+		const auto it = find_item(chunk, cursor);
+		if (it == chunk.end() || it->cursor != cursor) { return false; }
+		it->entity = entity;
+		return true;
+	}
+
+	/**
+	 * remove the entity of a cursor, the entities after it keep their order.
+	 * @param cursor - cursor of the id of the entity.
+	 * @return true if the entity was removed, false if the list does not have the cursor.
+	 */
+	bool erase(const Entity_Order::Cursor& cursor) {
+		const size_t position = find_chunk(cursor);
+		if (position == m_chunks.size()) { return false; }
+		const auto shared = find_item(*m_chunks[position], cursor);
+		if (shared == m_chunks[position]->end() || shared->cursor != cursor) { return false; }
+		const size_t item = static_cast<size_t>(shared - m_chunks[position]->begin());
+		Chunk& chunk = get_own_chunk(position);
+		chunk.erase(chunk.begin() + static_cast<std::ptrdiff_t>(item));
+		if (chunk.empty()) { m_chunks.erase(m_chunks.begin() + static_cast<std::ptrdiff_t>(position)); }
+		--m_size;
+		return true;
+	}
+};
+
+#endif // VERSION_LIST_H
@@ -1,11 +1,15 @@
 #ifndef COURSE_H
 #define COURSE_H
 
+#include <functional>
+#include <stdexcept>
+#include <string_view>
 #include <unordered_map>
 
 #include "Entity.h"
-
-class Course_Type;
+#include "../Object_Pool.h"
+#include "../Symbol_Table.h"
+#include "course_types/Course_Type.h"
 
 // Course class represents a row in the Courses CSV file.
 class Course : public Entity {
@@ -16,7 +20,15 @@ class Course : public Entity {
 
 	// each course can have multiple course types (lecture, tutorial, lab).
 	// note:: can have multiple lectures, tutorials, and labs. or none at all.
-	std::unordered_map<std::string, Course_Type*> m_course_types{};
+	// keys - handles of the group ids (see Symbol_Table), values - the course types.
+	// the course holds a reference to each group id.
+	std::unordered_map<Symbol_Table::Handle, Course_Type*> m_course_types{};
+
+	/*flag to check if the course types were loaded.
+	courses read by Entity_Manager load their course types lazily on first access (see load_course_types()).*/
+	mutable bool m_course_types_loaded{true};
+	// function to load the course types of a course, set by Entity_Manager.
+	inline static std::function<void(Course&)> course_types_loader{};
 
 	// validation methods.
 	static std::string validate_id(const std::string& id);
@@ -24,6 +36,13 @@ class Course : public Entity {
 	static std::string validate_name(const std::string& name);
 	static float validate_points(float points);
 
+	// helper function to find a course type by group id (an id that was never interned has no course type).
+	template <typename Map>
+	static auto find_course_type(Map& course_types, const std::string_view id) {
+		const Symbol_Table::Handle handle = Symbol_Table::get_instance().find(id);
+		return handle != Symbol_Table::no_handle ? course_types.find(handle) : course_types.end();
+	}
+
 public:
 	// constructors.
 	Course(const std::string& id, const std::string& name, const std::string& lecturer, float points);
@@ -34,16 +53,44 @@ public:
 	// since we have memory allocation so for clone() function we need operator=.
 	Course& operator=(const Course& other);
 
+	// courses are allocated in slabs of the Course pool instead of one heap allocation each (see Object_Pool).
+	static void* operator new(const size_t size) { return Object_Pool<Course>::get_instance().allocate(size); }
+	static void operator delete(void* pointer, const size_t size) {
+		Object_Pool<Course>::get_instance().deallocate(pointer, size);
+	}
+
 	// copy the course data.
 	Entity* clone() const override;
 
 	// convert the course data to a CSV format.
 	std::vector<std::string> to_csv() const override;
+	/**
+	 * append the course data as a CSV row to a buffer, without creating a vector of strings like to_csv().
+	 * @tparam Buffer - CSV_Writer or Catalog_Snapshot::Writer (has add_cell and end_row).
+	 * @param buffer - the buffer to append the row to.
+	 */
+	template <typename Buffer>
+	void append_csv(Buffer& buffer) const {
+		buffer.add_cell(m_id);
+		buffer.add_cell(m_name);
+		buffer.add_cell(m_lecturer);
+		buffer.add_cell(m_points);
+		buffer.end_row();
+	}
 	// convert the CSV data to a course object.
 	static Course* from_csv(const std::vector<std::string>& data);
+	// convert the CSV data views (see CSV_View) to a course object.
+	static Course* from_csv(const std::vector<std::string_view>& data) {
+		if (data.size() != 4) { throw std::invalid_argument("Invalid data size to create a course."); }
+		return new Course(std::string{data[0]}, std::string{data[1]}, std::string{data[2]},
+		                  std::stof(std::string{data[3]}));
+	}
 
 	// get the type of the entity (Course).
 	std::string get_type() const override;
+
+	// check if a type tag is of a course (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) { return type == Entity_Type::course; }
 	// get the file name of the course type.
 	static std::string get_file_name();
 
@@ -56,6 +103,13 @@ public:
 
 	std::string get_name() const override;
 	void set_name(const std::string& name) override;
+	// get the id and name as views of the course data, no copy is made (unlike get_id() and get_name()).
+	// note: the view is valid until the course is changed or destroyed.
+	std::string_view get_id_view() const { return m_id; }
+	std::string_view get_name_view() const { return m_name; }
+
+	// get the lecturer name of the course, as a view of the course data.
+	std::string_view get_lecturer_view() const { return m_lecturer; }
 
 	float get_points() const;
 	void set_points(float points);
@@ -65,18 +119,115 @@ public:
 	// friend operator to print the course data.
 	friend std::ostream& operator<<(std::ostream& os, const Course& course);
 
+	// load the course types on first access, if the course was read with lazy course types.
+	// also used to prefetch the course types of a course.
+	void load_course_types() const {
+		if (m_course_types_loaded) { return; }
+		// set first, since the loader adds the course types through add_course_type().
+		m_course_types_loaded = true;
+		if (course_types_loader) { course_types_loader(const_cast<Course&>(*this)); }
+	}
+
+	// check if the course types were loaded.
+	bool is_course_types_loaded() const { return m_course_types_loaded; }
+
+	// mark the course types as not loaded, they are loaded by the loader on first access.
+	void set_lazy_course_types() { m_course_types_loaded = false; }
+
+	// set the function that loads the course types of a course.
+	static void set_course_types_loader(std::function<void(Course&)> loader) {
+		course_types_loader = std::move(loader);
+	}
+
+	// note: the course type accessors are defined here so they load the course types on first access.
 	// get course type by id.
-	Course_Type* get_course_type(const std::string& id) const;
+	Course_Type* get_course_type(const std::string_view id) const {
+		load_course_types();
+		const auto it = find_course_type(m_course_types, id);
+		return it != m_course_types.end() ? it->second : nullptr;
+	}
+
+	// get course type by the handle of its group id (see Entity_Order::const_iterator::get_handle()).
+	Course_Type* get_course_type(const Symbol_Table::Handle handle) const {
+		load_course_types();
+		const auto it = m_course_types.find(handle);
+		return it != m_course_types.end() ? it->second : nullptr;
+	}
+
+	// call func with each course type of the course (in no particular order).
+	template <typename Func>
+	void for_each_course_type(Func&& func) const {
+		load_course_types();
+		for (const auto& [handle, course_type] : m_course_types) { func(*course_type); }
+	}
 
 	// set course type by id.
-	void set_course_type(const std::string& id, Course_Type* course_type);
+	void set_course_type(const std::string_view id, Course_Type* course_type) {
+		load_course_types();
+		if (!course_type) { throw std::invalid_argument("Course type cannot be nullptr."); }
+		const auto it = find_course_type(m_course_types, id);
+		if (it == m_course_types.end()) { throw std::invalid_argument("Course type doesn't exist."); }
+		it->second = course_type;
+	}
 
 	// add course type to the course.
 	// if the course type already exists, throws an exception.
-	void add_course_type(Course_Type* course_type);
+	void add_course_type(Course_Type* course_type) {
+		load_course_types();
+		if (!course_type) { throw std::invalid_argument("Course type cannot be nullptr."); }
+		const std::string_view id = course_type->get_id_view();
+		Symbol_Table& table = Symbol_Table::get_instance();
+		const Symbol_Table::Handle handle = table.intern(id);
+		if (!m_course_types.emplace(handle, course_type).second) {
+			table.release(handle); // the course already holds a reference to the group id.
+			throw std::invalid_argument("Course type with group id: " + std::string{id} + " already exists.");
+		}
+	}
 
 	// remove course type from the course.
-	void remove_course_type(const std::string& course_type_id);
+	void remove_course_type(const std::string_view course_type_id) {
+		delete release_course_type(course_type_id); // delete the course type object.
+	}
+
+	/**
+	 * remove course type from the course without deleting it (see Entity_Manager::retire()).
+	 * @param course_type_id - group id of the course type.
+	 * @return the removed course type, the caller deletes it.
+	 */
+	Course_Type* release_course_type(const std::string_view course_type_id) {
+		load_course_types();
+		const auto it = find_course_type(m_course_types, course_type_id);
+		if (it == m_course_types.end()) {
+			throw std::invalid_argument("Course type with id: " + std::string{course_type_id} + " doesn't exist.");
+		}
+		Course_Type* course_type = it->second;
+		const Symbol_Table::Handle handle = it->first;
+		m_course_types.erase(it);
+		Symbol_Table::get_instance().release(handle);
+		return course_type;
+	}
+
+	/**
+	 * copy the course with the same course type objects (not copies of them, unlike the copy constructor).
+	 * used for a new catalog version, while the old versions still print the course (see Catalog_Version).
+	 * note: the copy owns the course types, release_course_types() has to be called before the course is deleted.
+	 * @return the copy, the caller deletes it.
+	 */
+	Course* share_course_types() const {
+		load_course_types();
+		Course* copy = new Course(m_id, m_name, m_lecturer, m_points);
+		copy->m_course_types = m_course_types;
+		Symbol_Table& table = Symbol_Table::get_instance();
+		for (const auto& [handle, course_type] : m_course_types) { table.acquire(handle); }
+		return copy;
+	}
+
+	// forget the course types without deleting them, once a copy of the course owns them (see share_course_types()).
+	void release_course_types() {
+		Symbol_Table& table = Symbol_Table::get_instance();
+		for (const auto& [handle, course_type] : m_course_types) { table.release(handle); }
+		m_course_types.clear();
+	}
 };
 
 #endif //COURSE_H
@@ -1,14 +1,21 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
+// type tag of the entity types, a compact alternative to get_type() and dynamic_cast (see Entity::cast()).
+enum class Entity_Type : uint8_t { student, teacher, course, lecture, tutorial, lab };
+
 // Entity class is an interface and the base class for all entities (Student, Teacher, Course).
 class Entity {
+	// type tag of the entity, set once by the constructor of the derived class.
+	Entity_Type m_entity_type{};
+
 protected:
-	// protected constructor so the derived classes can call it.
-	Entity() = default;
+	// protected constructor so the derived classes can call it (with their type tag).
+	explicit Entity(const Entity_Type type) : m_entity_type{type} {}
 
 public:
 	// virtual destructor so the derived classes destructors are called.
@@ -26,6 +33,25 @@ public:
 	// virtual method to get the type of an entity.
 	virtual std::string get_type() const = 0;
 
+	// get the type tag of an entity (no string is created and no virtual call is made, unlike get_type()).
+	Entity_Type get_entity_type() const { return m_entity_type; }
+
+	/**
+	 * checked downcast by the type tag, instead of dynamic_cast.
+	 * @tparam T - type to downcast to (Student, Teacher, Course, Course_Type, Lecture, Tutorial, Lab).
+	 * @param entity - pointer to the entity (can be nullptr).
+	 * @return pointer to the entity as T, nullptr if the entity is nullptr or not a T.
+	 */
+	template <typename T>
+	static T* cast(Entity* entity) {
+		return entity && T::is_entity_type(entity->get_entity_type()) ? static_cast<T*>(entity) : nullptr;
+	}
+
+	template <typename T>
+	static const T* cast(const Entity* entity) {
+		return entity && T::is_entity_type(entity->get_entity_type()) ? static_cast<const T*>(entity) : nullptr;
+	}
+
 	// virtual method to search for a text in the entity data.
 	virtual bool search(const std::string& text) const = 0;
 
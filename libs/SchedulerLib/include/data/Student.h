@@ -1,7 +1,11 @@
 #ifndef STUDENT_H
 #define STUDENT_H
 
+#include <stdexcept>
+#include <string_view>
+
 #include "Entity.h"
+#include "../Object_Pool.h"
 
 // forward declaration since it used as a pointer or reference.
 class Schedule_Manager;
@@ -29,17 +33,43 @@ public:
 	Student(const Student& other);
 	~Student();
 
+	// students are allocated in slabs of the Student pool instead of one heap allocation each (see Object_Pool).
+	static void* operator new(const size_t size) { return Object_Pool<Student>::get_instance().allocate(size); }
+	static void operator delete(void* pointer, const size_t size) {
+		Object_Pool<Student>::get_instance().deallocate(pointer, size);
+	}
+
 	// copy the student data (uses the copy constructor).
 	Entity* clone() const override;
 
 	// convert the student data to a CSV format row.
 	std::vector<std::string> to_csv() const override;
+	/**
+	 * append the student data as a CSV row to a buffer, without creating a vector of strings like to_csv().
+	 * @tparam Buffer - CSV_Writer or Catalog_Snapshot::Writer (has add_cell and end_row).
+	 * @param buffer - the buffer to append the row to.
+	 */
+	template <typename Buffer>
+	void append_csv(Buffer& buffer) const {
+		buffer.add_cell(m_id);
+		buffer.add_cell(m_name);
+		buffer.add_cell(m_password);
+		buffer.end_row();
+	}
 	// convert the CSV data to a student object.
 	static Student* from_csv(const std::vector<std::string>& data);
+	// convert the CSV data views (see CSV_View) to a student object.
+	static Student* from_csv(const std::vector<std::string_view>& data) {
+		if (data.size() != 3) { throw std::invalid_argument("Invalid CSV data to create a student."); }
+		return new Student(std::string{data[0]}, std::string{data[1]}, std::string{data[2]});
+	}
 
 	// get the type of the entity (Student).
 	std::string get_type() const override;
 
+	// check if a type tag is of a student (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) { return type == Entity_Type::student; }
+
 	// get the file name of the course type.
 	static std::string get_file_name();
 
@@ -51,6 +81,9 @@ public:
 	void set_id(const std::string& id) override;
 	std::string get_name() const override;
 	void set_name(const std::string& name) override;
+	// get the id and name as views of the student data (see Course::get_id_view()).
+	std::string_view get_id_view() const { return m_id; }
+	std::string_view get_name_view() const { return m_name; }
 	std::string get_password() const;
 	void set_password(const std::string& password);
 
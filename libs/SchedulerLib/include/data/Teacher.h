@@ -1,7 +1,11 @@
 #ifndef TEACHER_H
 #define TEACHER_H
 
+#include <stdexcept>
+#include <string_view>
+
 #include "Entity.h"
+#include "../Object_Pool.h"
 
 // Teacher class represents a row in the Teachers CSV file.
 class Teacher : public Entity {
@@ -20,17 +24,42 @@ public:
 	Teacher(const Teacher& other);
 	// destructor is not needed since there are no pointers or memory allocation (default destructor is used).
 
+	// teachers are allocated in slabs of the Teacher pool instead of one heap allocation each (see Object_Pool).
+	static void* operator new(const size_t size) { return Object_Pool<Teacher>::get_instance().allocate(size); }
+	static void operator delete(void* pointer, const size_t size) {
+		Object_Pool<Teacher>::get_instance().deallocate(pointer, size);
+	}
+
 	// copy the teacher data.
 	Entity* clone() const override;
 
 	// convert the teacher data to a CSV format.
 	std::vector<std::string> to_csv() const override;
+	/**
+	 * append the teacher data as a CSV row to a buffer, without creating a vector of strings like to_csv().
+	 * @tparam Buffer - CSV_Writer or Catalog_Snapshot::Writer (has add_cell and end_row).
+	 * @param buffer - the buffer to append the row to.
+	 */
+	template <typename Buffer>
+	void append_csv(Buffer& buffer) const {
+		buffer.add_cell(m_id);
+		buffer.add_cell(m_name);
+		buffer.end_row();
+	}
 	// convert the CSV data to a teacher object.
 	static Teacher* from_csv(const std::vector<std::string>& data);
+	// convert the CSV data views (see CSV_View) to a teacher object.
+	static Teacher* from_csv(const std::vector<std::string_view>& data) {
+		if (data.size() != 2) { throw std::invalid_argument("Invalid CSV data to create a teacher."); }
+		return new Teacher(std::string{data[0]}, std::string{data[1]});
+	}
 
 	// get the type of the entity (Teacher).
 	std::string get_type() const override;
 
+	// check if a type tag is of a teacher (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) { return type == Entity_Type::teacher; }
+
 	// get the file name of the course type.
 	static std::string get_file_name();
 
@@ -42,6 +71,9 @@ public:
 	void set_id(const std::string& id) override;
 	std::string get_name() const override;
 	void set_name(const std::string& name) override;
+	// get the id and name as views of the teacher data (see Course::get_id_view()).
+	std::string_view get_id_view() const { return m_id; }
+	std::string_view get_name_view() const { return m_name; }
 
 	// override to_string method.
 	std::string to_string() const override;
@@ -2,10 +2,13 @@
 #define COURSE_TYPE_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <ctime>
+#include <stdexcept>
 
 #include "../Entity.h"
+#include "../../Object_Pool.h"
 
 // Course_Type class is an abstract class and the base class for all course types (Lecture, Tutorial, Lab).
 class Course_Type : public Entity {
@@ -26,28 +29,71 @@ protected:
 	static std::string validate_lecturer(const std::string& lecturer);
 	static std::string validate_classroom(const std::string& classroom);
 
-	// protected constructors so the derived classes can call it.
-	Course_Type(const std::string& id, const std::string& day, const std::string& start_time,
+	// protected constructors so the derived classes can call it (with their type tag).
+	Course_Type(Entity_Type type, const std::string& id, const std::string& day, const std::string& start_time,
 	            unsigned duration, const std::string& lecturer, const std::string& classroom);
 	Course_Type(const Course_Type& other);
 
+	/**
+	 * shared from_csv for the derived classes, creates a course type of type T from CSV data views.
+	 * @tparam T - type of course type (Lecture, Tutorial, Lab).
+	 * @param data - the csv row as views (see CSV_View).
+	 * @param error_msg - error message if the row has the wrong size.
+	 * @return pointer to the created course type.
+	 */
+	template <typename T>
+	static T* from_csv_view(const std::vector<std::string_view>& data, const char* error_msg) {
+		if (data.size() != 6) { throw std::invalid_argument(error_msg); }
+		return new T(std::string{data[0]}, std::string{data[1]}, std::string{data[2]},
+		             static_cast<unsigned>(std::stoi(std::string{data[3]})), std::string{data[4]},
+		             std::string{data[5]});
+	}
 
 public:
 	// virtual destructor so the derived classes destructors are called.
 	virtual ~Course_Type() = default;
 
+	// course types (Lecture, Tutorial, Lab) are allocated in slabs of the Course_Type pool (see Object_Pool).
+	// note: a course type is deleted through its virtual destructor, so it is returned to the pool it came from.
+	static void* operator new(const size_t size) { return Object_Pool<Course_Type>::get_instance().allocate(size); }
+	static void operator delete(void* pointer, const size_t size) {
+		Object_Pool<Course_Type>::get_instance().deallocate(pointer, size);
+	}
+
 	// pure virtual method to copy the course type object. (since copy constructor cant be virtual).
 	virtual Course_Type* clone() const = 0;
 
 	// virtual method get_type() to return the type of the course type.
 	virtual std::string get_type() const = 0;
 
+	// check if a type tag is of a course type (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) {
+		return type == Entity_Type::lecture || type == Entity_Type::tutorial || type == Entity_Type::lab;
+	}
+
 	// convert the course type data to a CSV format.
 	// since each course type has the same implementation for this method we can define it here.
 	std::vector<std::string> to_csv() const override;
 	// static method to convert the CSV data to a course type object.
 	// cant be defined here since it is different for each derived class.
 
+	/**
+	 * append the course type data as a CSV row to a buffer, without creating a vector of strings like to_csv().
+	 * note: the same for each course type, like to_csv().
+	 * @tparam Buffer - CSV_Writer or Catalog_Snapshot::Writer (has add_cell and end_row).
+	 * @param buffer - the buffer to append the row to.
+	 */
+	template <typename Buffer>
+	void append_csv(Buffer& buffer) const {
+		buffer.add_cell(m_id);
+		buffer.add_cell(m_day);
+		buffer.add_cell(time_to_string(m_start_time));
+		buffer.add_cell(m_duration);
+		buffer.add_cell(m_lecturer);
+		buffer.add_cell(m_classroom);
+		buffer.end_row();
+	}
+
 	// search for a text in the course type data.
 	// since each course type has the same implementation for this method we can define it here.
 	bool search(const std::string& text) const override;
@@ -59,6 +105,9 @@ public:
 	// not naming it get_lecturer and set_lecturer to override the base class get_name and set_name methods.
 	std::string get_name() const override;
 	void set_name(const std::string& lecturer) override;
+	// get the id and lecturer name as views of the course type data (see Course::get_id_view()).
+	std::string_view get_id_view() const { return m_id; }
+	std::string_view get_name_view() const { return m_lecturer; }
 
 	std::tm get_start_time() const;
 	void set_start_time(const std::tm& start_time);
@@ -72,6 +121,12 @@ public:
 	std::string get_classroom() const;
 	void set_classroom(const std::string& classroom);
 
+	// get the day and classroom as views of the course type data (see get_id_view()).
+	std::string_view get_day_view() const { return m_day; }
+	std::string_view get_classroom_view() const { return m_classroom; }
+	// get the hour the course type starts at (0 - 23).
+	int get_start_hour() const { return m_start_time.tm_hour; }
+
 	// convert the course type data to a string.
 	std::string to_string() const override;
 	// friend operator to print the course type data.
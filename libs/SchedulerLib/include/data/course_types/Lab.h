@@ -18,11 +18,18 @@ public:
 	// get the type of the course type (Lab).
 	std::string get_type() const override;
 
+	// check if a type tag is of a lab (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) { return type == Entity_Type::lab; }
+
 	// get the file name of the course type.
 	static std::string get_file_name();
 
 	// convert the CSV data to a lab object.
 	static Lab* from_csv(const std::vector<std::string>& data);
+	// convert the CSV data views (see CSV_View) to a lab object.
+	static Lab* from_csv(const std::vector<std::string_view>& data) {
+		return from_csv_view<Lab>(data, "Invalid data size to create a lab.");
+	}
 };
 
 #endif //LAB_H
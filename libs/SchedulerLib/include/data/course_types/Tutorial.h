@@ -18,11 +18,18 @@ public:
 	// get the type of the course type (Tutorial).
 	std::string get_type() const override;
 
+	// check if a type tag is of a tutorial (see Entity::cast()).
+	static constexpr bool is_entity_type(const Entity_Type type) { return type == Entity_Type::tutorial; }
+
 	// get the file name of the course type.
 	static std::string get_file_name();
 
 	// convert the CSV data to a tutorial object.
 	static Tutorial* from_csv(const std::vector<std::string>& data);
+	// convert the CSV data views (see CSV_View) to a tutorial object.
+	static Tutorial* from_csv(const std::vector<std::string_view>& data) {
+		return from_csv_view<Tutorial>(data, "Invalid data size to create a tutorial.");
+	}
 };
 
 #endif //TUTORIAL_H
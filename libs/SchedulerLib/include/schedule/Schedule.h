@@ -2,9 +2,12 @@
 #define SCHEDULE_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 
+#include "../Symbol_Table.h"
+
 // forward declaration since only using pointers or references to the class.
 class Course_Type;
 
@@ -12,15 +15,27 @@ class Course_Type;
 class Schedule {
 	// id of the schedule.
 	unsigned m_id{};
-	/*map of courses as keys are the course ids and values are the course_type objects.
-	since we need both the course id and the associated course types (lecture, tutorial, lab).*/
-	std::unordered_map<std::string, std::vector<Course_Type*>> m_courses{};
+	/*map of courses as keys are the handles of the course ids (see Symbol_Table) and values are the course types.
+	since we need both the course id and the associated course types (lecture, tutorial, lab).
+	note: the schedule holds a reference to the handle of each course id in the map.*/
+	std::unordered_map<Symbol_Table::Handle, std::vector<Course_Type*>> m_courses{};
+
+	/*helper function to find a course by id (an id that was never interned is not in the schedule).
+	the id is looked up as a view in the symbol table, so no string is made for the lookup.*/
+	template <typename Map>
+	static auto find_course(Map& courses, const std::string_view course_id) {
+		const Symbol_Table::Handle handle = Symbol_Table::get_instance().find(course_id);
+		return handle != Symbol_Table::no_handle ? courses.find(handle) : courses.end();
+	}
+
+	// get the course types of a course id, the course is added (and its id interned) if it is not in the schedule.
+	std::vector<Course_Type*>& add_course(const std::string& course_id);
 
 	// check if the course id exists in the m_courses map.
-	bool course_exists(const std::string& course_id) const;
+	bool course_exists(std::string_view course_id) const;
 
 	// check if the course type exists in the m_courses map.
-	bool course_type_exists(const std::string& course_id, const std::string& group_id) const;
+	bool course_type_exists(std::string_view course_id, std::string_view group_id) const;
 
 	// clean up the schedule data.
 	void clean_up();
@@ -31,7 +46,7 @@ class Schedule {
 	void validate_course_and_type(const std::string& course_id, const std::string& group_id) const;
 
 	// helper method to search for course id by type.
-	bool search_by_type(const std::string& course_id, const std::string& type) const;
+	bool search_by_type(std::string_view course_id, const std::string& type) const;
 
 	// check if the schedule is empty.
 	void check_empty() const;
@@ -106,13 +121,13 @@ public
 	 * @param course_id - the course id with the associated course type.
 	 * @param group_id - the course_type with the group id.
 	 */
-	void remove_course_type(const std::string& course_id, const std::string& group_id);
+	void remove_course_type(std::string_view course_id, std::string_view group_id);
 	/**
 	 * search for a course in the schedule and print the course types.
 	 * @param course_id - the course id to search for.
 	 * @return true if found any course types in schedule, false otherwise.
 	 */
-	bool search(const std::string& course_id) const;
+	bool search(std::string_view course_id) const;
 
 	/**
 	 * prints the weekly hours and points for all courses in the schedule.
@@ -128,7 +143,7 @@ public
 	unsigned get_id() const;
 	void set_id(unsigned id);
 
-	const Course_Type* get_course_type(const std::string& course_id, const std::string& group_id) const;
+	const Course_Type* get_course_type(std::string_view course_id, std::string_view group_id) const;
 
 	/**
 	 * print the schedule in a table format and return it as a string.
@@ -15,8 +15,9 @@ class Schedule_Manager {
 	note: dont need pointers of schedules as schedule doesn't have inheritance or virtual functions.*/
 	std::vector<Schedule> m_schedules{};
 
-	// counter for the schedule id.
-	static unsigned m_id_counter;
+	/*counter for the schedule id, each student numbers its own schedules from 1.
+	note: not shared between the managers, so students can be created on several threads (see Entity_Manager).*/
+	unsigned m_id_counter{};
 
 	// read the schedules for a student from the file.
 	void read_schedules();
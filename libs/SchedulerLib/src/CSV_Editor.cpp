@@ -0,0 +1,77 @@
+#include "../include/CSV_Editor.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+
+std::vector<std::string> CSV_Editor::split(const std::string& line) {
+	std::vector<std::string> row{};
+	std::string cell{};
+	// add a cell on every delimiter.
+	for (const char ch : line) {
+		if (ch == delimiter) {
+			row.push_back(cell);
+			cell.clear();
+		}
+		else { cell += ch; }
+	}
+	// the last cell (can be empty if the line ends with a delimiter).
+	row.push_back(cell);
+	return row;
+}
+
+std::string CSV_Editor::join(const std::vector<std::string>& row) {
+	std::string line{};
+	for (size_t i = 0; i < row.size(); i++) {
+		if (i > 0) { line += delimiter; }
+		line += row[i];
+	}
+	return line;
+}
+
+std::vector<std::vector<std::string>> CSV_Editor::read_csv(const std::string& file_name) {
+	std::ifstream file(get_path(file_name));
+	// if the file does not exist, create an empty one.
+	if (!file.is_open()) {
+		create_csv(file_name);
+		return {};
+	}
+
+	std::vector<std::vector<std::string>> data{};
+	std::string line{};
+	while (std::getline(file, line)) {
+		// skip empty lines.
+		if (line.empty()) { continue; }
+		// remove the utf-8 byte order mark of the first line.
+		if (data.empty() && line.size() > 2 && line.compare(0, 3, "\xEF\xBB\xBF") == 0) { line.erase(0, 3); }
+		data.push_back(split(line));
+	}
+	file.close();
+	return data;
+}
+
+void CSV_Editor::write_csv(const std::string& file_name, const std::vector<std::vector<std::string>>& data) {
+	const std::string path = get_path(file_name);
+	std::ofstream file(path);
+	if (!file.is_open()) { throw std::runtime_error("Error: could not open file " + path); }
+	for (const std::vector<std::string>& row : data) { file << join(row) << '\n'; }
+	file.close();
+}
+
+void CSV_Editor::create_csv(const std::string& file_name) {
+	const std::string path = get_path(file_name);
+	std::ofstream file(path);
+	if (!file.is_open()) { throw std::runtime_error("Error: could not create file " + path); }
+	file.close();
+}
+
+void CSV_Editor::delete_csv(const std::string& file_name) {
+	const std::string path = get_path(file_name);
+	// close the file before deleting it.
+	std::ifstream file(path);
+	if (file.is_open()) { file.close(); }
+	// a missing file is already deleted (like the course type files of a course that was not written yet).
+	if (std::remove(path.c_str()) != 0 && errno != ENOENT) {
+		throw std::runtime_error("Error: could not delete file " + path);
+	}
+}
@@ -0,0 +1,24 @@
+#include "../include/Entity_Manager.h"
+
+#include "../include/data/Student.h"
+#include "../include/data/Teacher.h"
+
+Entity_Manager::Entity_Manager() {
+	// the pools and the symbol table are created before any entity (course types are loaded lazily, after
+	// this constructor), so they are destroyed after the manager deletes its entities and releases their ids.
+	Object_Pool<Student>::get_instance();
+	Object_Pool<Teacher>::get_instance();
+	Object_Pool<Course>::get_instance();
+	Object_Pool<Course_Type>::get_instance();
+	Symbol_Table::get_instance();
+	// read the main types, each course reads its course types with it (see process_course()).
+	read_entities<Student>();
+	read_entities<Teacher>();
+	read_entities<Course>();
+}
+
+Entity_Manager::~Entity_Manager() {
+	// write the modified files and the snapshot (see checkpoint()), then delete the entities.
+	checkpoint();
+	delete_entities();
+}
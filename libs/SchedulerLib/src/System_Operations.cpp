@@ -0,0 +1,156 @@
+#include "../include/System_Operations.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/data/Teacher.h"
+
+bool System_Operations::print_course(const std::string& id) {
+	try {
+		Entity_Manager::get_instance().print_entity<Course>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing course: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::add_course(const std::string& id, const std::string& name, const std::string& lecturer,
+                                   const std::string& points) {
+	Course* course{};
+	try {
+		course = new Course(id, name, lecturer, std::stof(points));
+		Entity_Manager::get_instance().add_entity<Course>(course);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error adding course: " << e.what() << std::endl;
+		delete course; // delete the course when an exception occurs.
+		course = nullptr;
+		return false;
+	}
+}
+
+bool System_Operations::rm_course(const std::string& id) {
+	try {
+		// removes the course types of the course with it.
+		Entity_Manager::get_instance().remove_entity<Course>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error removing course: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::print_teacher(const std::string& id) {
+	try {
+		Entity_Manager::get_instance().print_entity<Teacher>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing teacher: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::add_lecturer(const std::string& id, const std::string& name) {
+	Teacher* teacher{};
+	try {
+		teacher = new Teacher(id, name);
+		Entity_Manager::get_instance().add_entity<Teacher>(teacher);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error adding lecturer: " << e.what() << std::endl;
+		delete teacher; // delete the teacher when an exception occurs.
+		teacher = nullptr;
+		return false;
+	}
+}
+
+bool System_Operations::rm_lecturer(const std::string& id) {
+	try {
+		Entity_Manager::get_instance().remove_entity<Teacher>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error removing lecturer: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::print_student(const std::string& id) {
+	try {
+		Entity_Manager::get_instance().print_entity<Student>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing student: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::add_student(const std::string& id, const std::string& name, const std::string& password) {
+	Student* student{};
+	try {
+		student = new Student(id, name, password);
+		Entity_Manager::get_instance().add_entity<Student>(student);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error adding student: " << e.what() << std::endl;
+		delete student; // delete the student when an exception occurs.
+		student = nullptr;
+		return false;
+	}
+}
+
+bool System_Operations::rm_student(const std::string& id) {
+	try {
+		Entity_Manager::get_instance().remove_entity<Student>(id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error removing student: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool System_Operations::search(const std::string& text) {
+	Entity_Manager& manager = Entity_Manager::get_instance();
+	// search all types, each prints its own matches (sorted by the order of its type).
+	bool found = manager.search_entites<Course>(text);
+	found = manager.search_entites<Teacher>(text) || found;
+	found = manager.search_entites<Student>(text) || found;
+	if (!found) { std::cerr << "No results found for: " << text << std::endl; }
+	return found;
+}
+
+bool System_Operations::authenticate_student(const std::string& id, const std::string& password) {
+	try {
+		const Student* student = Entity_Manager::get_instance().get_entity<Student>(id);
+		if (!student) { throw std::invalid_argument("Student with id: " + id + " was not found."); }
+		if (student->get_password() != password) { throw std::invalid_argument("Invalid password."); }
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error authenticating student: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+Schedule_Manager* System_Operations::get_student_schedule_manager(const std::string& id) {
+	try {
+		// the student is looked up by id on every call, since sessions of several students run at the same time.
+		const Student* student = Entity_Manager::get_instance().get_entity<Student>(id);
+		if (!student) { throw std::invalid_argument("Student with id: " + id + " was not found."); }
+		return student->get_schedule_manager();
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error getting student schedule manager: " << e.what() << std::endl;
+		return nullptr;
+	}
+}
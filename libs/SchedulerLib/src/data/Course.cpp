@@ -0,0 +1,139 @@
+#include "../../include/data/Course.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
+#include "../../include/data/course_types/Course_Type.h"
+
+std::string Course::validate_id(const std::string& id) {
+	if (id.empty()) { throw std::invalid_argument("Course id cannot be empty."); }
+	if (id.size() != 5) { throw std::invalid_argument("Course id must be 5 characters long."); }
+	if (!std::all_of(id.begin(), id.end(), [](const unsigned char ch) { return std::isdigit(ch); })) {
+		throw std::invalid_argument("Course id must contain only digits.");
+	}
+	return id;
+}
+
+std::string Course::validate_name(const std::string& name) {
+	if (name.empty()) { throw std::invalid_argument("Course name cannot be empty."); }
+	return name;
+}
+
+float Course::validate_points(const float points) {
+	if (points <= 0) { throw std::invalid_argument("Course points must be positive."); }
+	// check the points have at most one decimal digit, and that it is .0 or .5.
+	const float scaled = points * 10;
+	const int tenths = static_cast<int>(scaled);
+	if (scaled - static_cast<float>(tenths) != 0) {
+		throw std::invalid_argument("Course points must have only one decimal point.");
+	}
+	if (tenths % 5 != 0) { throw std::invalid_argument("Course points must have .5 or .0 decimal points."); }
+	return points;
+}
+
+Course::Course(const std::string& id, const std::string& name, const std::string& lecturer, const float points)
+	: Entity(Entity_Type::course), m_id{validate_id(id)}, m_name{validate_name(name)},
+	  m_lecturer{validate_name(lecturer)}, m_points{validate_points(points)} {}
+
+void Course::deep_copy_course_types(const Course& other) {
+	// copy each course type, so the copy does not share them with the other course.
+	other.load_course_types();
+	Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_type] : other.m_course_types) {
+		m_course_types[table.acquire(handle)] = course_type->clone();
+	}
+}
+
+Course::Course(const Course& other) : Entity(other), m_id{other.m_id}, m_name{other.m_name},
+                                      m_lecturer{other.m_lecturer}, m_points{other.m_points} {
+	deep_copy_course_types(other);
+}
+
+void Course::clean_up() {
+	// delete all course types and avoid dangling pointers, and release the group ids.
+	Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_type] : m_course_types) {
+		delete course_type;
+		table.release(handle);
+	}
+	m_course_types.clear();
+}
+
+Course::~Course() {
+	clean_up();
+}
+
+Course& Course::operator=(const Course& other) {
+	// check for self assignment.
+	if (this == &other) { return *this; }
+	m_id = other.m_id;
+	m_name = other.m_name;
+	m_lecturer = other.m_lecturer;
+	m_points = other.m_points;
+	// delete the old course types before copying the new ones.
+	clean_up();
+	// the copied course types replace the lazy ones, which must not be loaded on top of them.
+	m_course_types_loaded = true;
+	deep_copy_course_types(other);
+	return *this;
+}
+
+Entity* Course::clone() const { return new Course(*this); }
+
+std::vector<std::string> Course::to_csv() const { return {m_id, m_name, m_lecturer, std::to_string(m_points)}; }
+
+Course* Course::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 4) { throw std::invalid_argument("Invalid data size to create a course."); }
+	return new Course(data[0], data[1], data[2], std::stof(data[3]));
+}
+
+std::string Course::get_type() const { return "Course"; }
+
+std::string Course::get_file_name() { return "Courses.csv"; }
+
+bool Course::search(const std::string& text) const {
+	// search the course data, then the data of its course types.
+	for (const std::string& cell : to_csv()) {
+		if (cell.find(text) != std::string::npos) { return true; }
+	}
+	load_course_types();
+	return std::any_of(m_course_types.begin(), m_course_types.end(), [&text](const auto& entry) {
+		return entry.second->search(text);
+	});
+}
+
+std::string Course::get_id() const { return m_id; }
+
+void Course::set_id(const std::string& id) { m_id = validate_id(id); }
+
+std::string Course::get_name() const { return m_name; }
+
+void Course::set_name(const std::string& name) { m_name = validate_name(name); }
+
+float Course::get_points() const { return m_points; }
+
+void Course::set_points(const float points) { m_points = validate_points(points); }
+
+std::string Course::to_string() const {
+	std::ostringstream out{};
+	out << "Course: ID: " << m_id << ", Name: " << m_name << ", Lecturer: " << m_lecturer << ", Points: "
+		<< std::fixed << std::setprecision(1) << m_points;
+	// group the course types by type, so they are printed as lectures, then tutorials, then labs.
+	std::unordered_map<std::string, std::vector<const Course_Type*>> groups{};
+	load_course_types();
+	for (const auto& [handle, course_type] : m_course_types) { groups[course_type->get_type()].push_back(course_type); }
+	for (const char* type : {"Lecture", "Tutorial", "Lab"}) {
+		const auto it = groups.find(type);
+		if (it == groups.end()) { continue; }
+		out << "\n" << type << "s:";
+		for (const Course_Type* course_type : it->second) { out << "\n" << *course_type; }
+	}
+	return out.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const Course& course) {
+	os << course.to_string();
+	return os;
+}
@@ -0,0 +1,95 @@
+#include "../../include/data/Student.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
+#include "../../include/schedule/Schedule_Manager.h"
+
+std::string Student::valid_id(const std::string& id) {
+	if (id.empty()) { throw std::invalid_argument("Student id cannot be empty."); }
+	if (id.size() != 9) { throw std::invalid_argument("Student id must be 9 digits."); }
+	if (!std::all_of(id.begin(), id.end(), [](const unsigned char ch) { return std::isdigit(ch); })) {
+		throw std::invalid_argument("Student id must contain only digits.");
+	}
+	return id;
+}
+
+std::string Student::valid_name(const std::string& name) {
+	if (name.empty()) { throw std::invalid_argument("Student name cannot be empty."); }
+	return name;
+}
+
+std::string Student::valid_password(const std::string& password) {
+	if (password.empty()) { throw std::invalid_argument("Student password cannot be empty."); }
+	if (password.size() < 8) { throw std::invalid_argument("Student password must be at least 8 characters long."); }
+	// the password must have at least one letter and one digit.
+	const bool has_letter = std::any_of(password.begin(), password.end(),
+	                                    [](const unsigned char ch) { return std::isalpha(ch); });
+	const bool has_digit = std::any_of(password.begin(), password.end(),
+	                                   [](const unsigned char ch) { return std::isdigit(ch); });
+	if (!has_letter || !has_digit) {
+		throw std::invalid_argument("Student password must contain both letters and digits.");
+	}
+	return password;
+}
+
+Student::Student(const std::string& id, const std::string& name, const std::string& password)
+	: Entity(Entity_Type::student), m_id{valid_id(id)}, m_name{valid_name(name)},
+	  m_password{valid_password(password)}, m_schedule_manager{new Schedule_Manager(m_id)} {}
+
+Student::Student(const Student& other)
+	: Entity(other), m_id{other.m_id}, m_name{other.m_name}, m_password{other.m_password},
+	  m_schedule_manager{new Schedule_Manager(*other.m_schedule_manager)} {}
+
+Student::~Student() {
+	// delete the schedule manager (writes the schedules) and avoid dangling pointer.
+	delete m_schedule_manager;
+	m_schedule_manager = nullptr;
+}
+
+Entity* Student::clone() const { return new Student(*this); }
+
+std::vector<std::string> Student::to_csv() const { return {m_id, m_name, m_password}; }
+
+Student* Student::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 3) { throw std::invalid_argument("Invalid CSV data to create a student."); }
+	return new Student(data[0], data[1], data[2]);
+}
+
+std::string Student::get_type() const { return "Student"; }
+
+std::string Student::get_file_name() { return "Students.csv"; }
+
+bool Student::search(const std::string& text) const {
+	for (const std::string& cell : to_csv()) {
+		if (cell.find(text) != std::string::npos) { return true; }
+	}
+	return false;
+}
+
+std::string Student::get_id() const { return m_id; }
+
+void Student::set_id(const std::string& id) { m_id = valid_id(id); }
+
+std::string Student::get_name() const { return m_name; }
+
+void Student::set_name(const std::string& name) { m_name = valid_name(name); }
+
+std::string Student::get_password() const { return m_password; }
+
+void Student::set_password(const std::string& password) { m_password = valid_password(password); }
+
+Schedule_Manager* Student::get_schedule_manager() const { return m_schedule_manager; }
+
+std::string Student::to_string() const {
+	std::ostringstream out{};
+	out << "Student: ID: " << m_id << ", Name: " << std::left << std::setw(7) << m_name << ", Password: " << m_password;
+	return out.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const Student& student) {
+	os << student.to_string();
+	return os;
+}
@@ -0,0 +1,63 @@
+#include "../../include/data/Teacher.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+std::string Teacher::validate_id(const std::string& id) {
+	if (id.empty()) { throw std::invalid_argument("Teacher id cannot be empty."); }
+	if (id.size() != 9) { throw std::invalid_argument("Teacher id must be 9 digits."); }
+	if (!std::all_of(id.begin(), id.end(), [](const unsigned char ch) { return std::isdigit(ch); })) {
+		throw std::invalid_argument("Teacher id must contain only digits.");
+	}
+	return id;
+}
+
+std::string Teacher::validate_name(const std::string& name) {
+	if (name.empty()) { throw std::invalid_argument("Teacher name cannot be empty."); }
+	return name;
+}
+
+Teacher::Teacher(const std::string& id, const std::string& name)
+	: Entity(Entity_Type::teacher), m_id{validate_id(id)}, m_name{validate_name(name)} {}
+
+Teacher::Teacher(const Teacher& other) : Entity(other), m_id{other.m_id}, m_name{other.m_name} {}
+
+Entity* Teacher::clone() const { return new Teacher(*this); }
+
+std::vector<std::string> Teacher::to_csv() const { return {m_id, m_name}; }
+
+Teacher* Teacher::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 2) { throw std::invalid_argument("Invalid CSV data to create a teacher."); }
+	return new Teacher(data[0], data[1]);
+}
+
+std::string Teacher::get_type() const { return "Teacher"; }
+
+std::string Teacher::get_file_name() { return "Teachers.csv"; }
+
+bool Teacher::search(const std::string& text) const {
+	for (const std::string& cell : to_csv()) {
+		if (cell.find(text) != std::string::npos) { return true; }
+	}
+	return false;
+}
+
+std::string Teacher::get_id() const { return m_id; }
+
+void Teacher::set_id(const std::string& id) { m_id = validate_id(id); }
+
+std::string Teacher::get_name() const { return m_name; }
+
+void Teacher::set_name(const std::string& name) { m_name = validate_name(name); }
+
+std::string Teacher::to_string() const {
+	std::ostringstream out{};
+	out << "Teacher: ID: " << m_id << ", Name: " << m_name;
+	return out.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const Teacher& teacher) {
+	os << teacher.to_string();
+	return os;
+}
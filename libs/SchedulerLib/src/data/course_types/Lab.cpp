@@ -0,0 +1,20 @@
+#include "../../../include/data/course_types/Lab.h"
+
+#include <stdexcept>
+
+Lab::Lab(const std::string& id, const std::string& day, const std::string& start_time,
+         const unsigned duration, const std::string& lecturer, const std::string& classroom)
+	: Course_Type(Entity_Type::lab, id, day, start_time, duration, lecturer, classroom) {}
+
+Lab::Lab(const Lab& other) : Course_Type(other) {}
+
+Lab* Lab::clone() const { return new Lab(*this); }
+
+std::string Lab::get_type() const { return "Lab"; }
+
+std::string Lab::get_file_name() { return "_labs.csv"; }
+
+Lab* Lab::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 6) { throw std::invalid_argument("Invalid data size to create a lab."); }
+	return new Lab(data[0], data[1], data[2], static_cast<unsigned>(std::stoi(data[3])), data[4], data[5]);
+}
@@ -0,0 +1,20 @@
+#include "../../../include/data/course_types/Lecture.h"
+
+#include <stdexcept>
+
+Lecture::Lecture(const std::string& group_id, const std::string& day, const std::string& start_time,
+                 const unsigned duration, const std::string& lecturer, const std::string& classroom)
+	: Course_Type(Entity_Type::lecture, group_id, day, start_time, duration, lecturer, classroom) {}
+
+Lecture::Lecture(const Lecture& other) : Course_Type(other) {}
+
+Lecture* Lecture::clone() const { return new Lecture(*this); }
+
+std::string Lecture::get_type() const { return "Lecture"; }
+
+std::string Lecture::get_file_name() { return "_lectures.csv"; }
+
+Lecture* Lecture::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 6) { throw std::invalid_argument("Invalid data size for Lecture object."); }
+	return new Lecture(data[0], data[1], data[2], static_cast<unsigned>(std::stoi(data[3])), data[4], data[5]);
+}
@@ -0,0 +1,20 @@
+#include "../../../include/data/course_types/Tutorial.h"
+
+#include <stdexcept>
+
+Tutorial::Tutorial(const std::string& id, const std::string& day, const std::string& start_time,
+                   const unsigned duration, const std::string& lecturer, const std::string& classroom)
+	: Course_Type(Entity_Type::tutorial, id, day, start_time, duration, lecturer, classroom) {}
+
+Tutorial::Tutorial(const Tutorial& other) : Course_Type(other) {}
+
+Tutorial* Tutorial::clone() const { return new Tutorial(*this); }
+
+std::string Tutorial::get_type() const { return "Tutorial"; }
+
+std::string Tutorial::get_file_name() { return "_tutorials.csv"; }
+
+Tutorial* Tutorial::from_csv(const std::vector<std::string>& data) {
+	if (data.size() != 6) { throw std::invalid_argument("Invalid data size to create a tutorial."); }
+	return new Tutorial(data[0], data[1], data[2], static_cast<unsigned>(std::stoi(data[3])), data[4], data[5]);
+}
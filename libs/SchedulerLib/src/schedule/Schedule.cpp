@@ -0,0 +1,349 @@
+#include "../../include/schedule/Schedule.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "../../include/Entity_Manager.h"
+#include "../../include/data/course_types/Course_Type.h"
+#include "../../include/data/course_types/Lab.h"
+#include "../../include/data/course_types/Lecture.h"
+#include "../../include/data/course_types/Tutorial.h"
+
+Schedule::Schedule(const unsigned id) : m_id{id} {}
+
+Schedule::Schedule(const Schedule& other) : m_id{other.m_id} {
+	deep_copy_schedule(other);
+}
+
+Schedule::~Schedule() {
+	clean_up();
+}
+
+Schedule& Schedule::operator=(const Schedule& other) {
+	// check for self assignment.
+	if (this == &other) { return *this; }
+	m_id = other.m_id;
+	// delete the old course types before copying the new ones.
+	clean_up();
+	deep_copy_schedule(other);
+	return *this;
+}
+
+void Schedule::clean_up() {
+	// delete all course types and avoid dangling pointers, and release the course ids.
+	Symbol_Table& table = Symbol_Table::get_instance();
+	for (auto& [handle, course_types] : m_courses) {
+		for (Course_Type*& course_type : course_types) {
+			delete course_type;
+			course_type = nullptr;
+		}
+		table.release(handle);
+	}
+	m_courses.clear();
+}
+
+void Schedule::deep_copy_schedule(const Schedule& other) {
+	// the schedule owns its course types, so each one is cloned (and holds its own reference to the course ids).
+	Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_types] : other.m_courses) {
+		std::vector<Course_Type*>& copies = m_courses[table.acquire(handle)];
+		for (const Course_Type* course_type : course_types) { copies.push_back(course_type->clone()); }
+	}
+}
+
+std::vector<Course_Type*>& Schedule::add_course(const std::string& course_id) {
+	Symbol_Table& table = Symbol_Table::get_instance();
+	const Symbol_Table::Handle handle = table.intern(course_id);
+	const auto [it, added] = m_courses.try_emplace(handle);
+	if (!added) { table.release(handle); } // the schedule already holds a reference to the course id.
+	return it->second;
+}
+
+Schedule Schedule::from_csv(const std::vector<std::string>& data) {
+	// the id, then 8 cells for each course type: course id, type and the 6 cells of the course type.
+	if (data.empty() || (data.size() - 1) % 8 != 0) {
+		throw std::invalid_argument("Invalid CSV data to create a schedule.");
+	}
+	Schedule schedule(static_cast<unsigned>(std::stoi(data[0])));
+	for (size_t i = 1; i < data.size(); i += 8) {
+		const std::string& course_id = data[i];
+		const std::string& type = data[i + 1];
+		const std::vector<std::string> fields(data.begin() + static_cast<long>(i) + 2,
+		                                      data.begin() + static_cast<long>(i) + 8);
+		Course_Type* course_type{};
+		if (type == "Lecture") { course_type = Lecture::from_csv(fields); }
+		else if (type == "Tutorial") { course_type = Tutorial::from_csv(fields); }
+		else if (type == "Lab") { course_type = Lab::from_csv(fields); }
+		else { throw std::invalid_argument("Invalid course type: " + type); }
+		schedule.add_course(course_id).push_back(course_type);
+	}
+	return schedule;
+}
+
+std::vector<std::string> Schedule::to_csv() const {
+	std::cout << std::endl;
+	std::vector<std::string> data{std::to_string(m_id)};
+	const Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_types] : m_courses) {
+		for (const Course_Type* course_type : course_types) {
+			data.push_back(table.get_id(handle));
+			data.push_back(course_type->get_type());
+			for (const std::string& cell : course_type->to_csv()) { data.push_back(cell); }
+		}
+	}
+	return data;
+}
+
+bool Schedule::course_exists(const std::string_view course_id) const {
+	return find_course(m_courses, course_id) != m_courses.end();
+}
+
+bool Schedule::course_type_exists(const std::string_view course_id, const std::string_view group_id) const {
+	return get_course_type(course_id, group_id) != nullptr;
+}
+
+void Schedule::add_course_type(const std::string& course_id, Course_Type* course_type) {
+	add_course(course_id).push_back(course_type);
+}
+
+void Schedule::validate_course_and_type(const std::string& course_id, const std::string& group_id) const {
+	const Course* course = Entity_Manager::get_instance().get_entity<Course>(course_id);
+	if (!course) { throw std::invalid_argument("Course with id: " + course_id + " does not exist."); }
+	if (!course->get_course_type(group_id)) {
+		throw std::invalid_argument("Course_Type with id: " + group_id + " does not exist.");
+	}
+	if (course_type_exists(course_id, group_id)) {
+		throw std::invalid_argument("Course_Type with id: " + group_id + " already exists in the schedule.");
+	}
+}
+
+void Schedule::add_course_type(const std::string& course_id, const std::string& group_id) {
+	validate_course_and_type(course_id, group_id);
+	// the schedule keeps its own copy of the course type.
+	const Course* course = Entity_Manager::get_instance().get_entity<Course>(course_id);
+	add_course(course_id).push_back(course->get_course_type(group_id)->clone());
+}
+
+void Schedule::remove_course_type(const std::string_view course_id, const std::string_view group_id) {
+	const auto it = find_course(m_courses, course_id);
+	if (it == m_courses.end()) {
+		throw std::invalid_argument("Course with id: " + std::string{course_id} + " does not exist in the schedule.");
+	}
+	std::vector<Course_Type*>& course_types = it->second;
+	const auto type_it = std::find_if(course_types.begin(), course_types.end(), [group_id](const Course_Type* type) {
+		return type->get_id_view() == group_id;
+	});
+	if (type_it == course_types.end()) {
+		throw std::invalid_argument("Course_Type with id: " + std::string{group_id} +
+		                            " does not exist in the schedule.");
+	}
+	// delete the course type and remove the course if it has no course types left.
+	delete *type_it;
+	course_types.erase(type_it);
+	if (course_types.empty()) {
+		const Symbol_Table::Handle handle = it->first;
+		m_courses.erase(it);
+		Symbol_Table::get_instance().release(handle);
+	}
+}
+
+bool Schedule::search_by_type(const std::string_view course_id, const std::string& type) const {
+	const auto it = find_course(m_courses, course_id);
+	if (it == m_courses.end()) { return false; }
+	if (it->second.empty()) {
+		throw std::invalid_argument("No " + type + "s found for course with id: " + std::string{course_id});
+	}
+	bool found{false};
+	for (const Course_Type* course_type : it->second) {
+		if (course_type->get_type() != type) { continue; }
+		// print the title before the first match.
+		if (!found) {
+			std::cout << "Schedule with id: " << m_id << std::endl << "Found in " << type << "s:" << std::endl;
+			found = true;
+		}
+		std::cout << *course_type << "\n";
+	}
+	return true;
+}
+
+bool Schedule::search(const std::string_view course_id) const {
+	// search all types, each prints its own matches.
+	bool found = search_by_type(course_id, "Lecture");
+	found = search_by_type(course_id, "Tutorial") || found;
+	found = search_by_type(course_id, "Lab") || found;
+	return found;
+}
+
+void Schedule::check_empty() const {
+	if (m_courses.empty()) { throw std::invalid_argument("No courses in the schedule."); }
+}
+
+void Schedule::print_weekly_summary() const {
+	check_empty();
+	double hours{};
+	float points{};
+	const Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_types] : m_courses) {
+		for (const Course_Type* course_type : course_types) { hours += course_type->get_duration() / 60.0; }
+		// the points of a course are counted once, however many of its course types are in the schedule.
+		const Course* course = Entity_Manager::get_instance().get_entity<Course>(table.get_id(handle));
+		if (course) { points += course->get_points(); }
+	}
+	std::cout << "Total weekly hours: " << hours << std::endl << "Total points: " << points << std::endl;
+}
+
+bool Schedule::find_overlapping_courses(const Course_Type* course1, const Course_Type* course2) {
+	const std::tm start_time1 = course1->get_start_time();
+	const std::tm start_time2 = course2->get_start_time();
+	const unsigned start1 = static_cast<unsigned>(start_time1.tm_hour * 60 + start_time1.tm_min);
+	const unsigned start2 = static_cast<unsigned>(start_time2.tm_hour * 60 + start_time2.tm_min);
+	const unsigned end1 = start1 + course1->get_duration();
+	const unsigned end2 = start2 + course2->get_duration();
+	return start1 < end2 && start2 < end1;
+}
+
+void Schedule::print_overlapping_courses() const {
+	std::vector<const Course_Type*> course_types{};
+	for (const auto& [handle, types] : m_courses) {
+		course_types.insert(course_types.end(), types.begin(), types.end());
+	}
+	bool found{false};
+	for (size_t i = 0; i < course_types.size(); i++) {
+		for (size_t j = 0; j < course_types.size(); j++) {
+			const Course_Type* first = course_types[i];
+			const Course_Type* second = course_types[j];
+			if (i == j || first->get_day() != second->get_day() || !find_overlapping_courses(first, second)) { continue; }
+			if (!found) {
+				std::cout << "Overlapping courses:" << std::endl;
+				found = true;
+			}
+			std::cout << "Course 1: " << *first << std::endl << "Course 2: " << *second << std::endl;
+		}
+	}
+	if (!found) { std::cout << "No overlapping courses found." << std::endl; }
+}
+
+unsigned Schedule::get_id() const { return m_id; }
+
+void Schedule::set_id(const unsigned id) { m_id = id; }
+
+const Course_Type* Schedule::get_course_type(const std::string_view course_id,
+                                             const std::string_view group_id) const {
+	const auto it = find_course(m_courses, course_id);
+	if (it == m_courses.end()) { return nullptr; }
+	for (const Course_Type* course_type : it->second) {
+		if (course_type->get_id_view() == group_id) { return course_type; }
+	}
+	return nullptr;
+}
+
+std::unordered_map<std::string, std::vector<std::vector<std::string>>> Schedule::create_schedule_Data(
+	const std::vector<std::string>& days, const unsigned hours_size) const {
+	std::unordered_map<std::string, std::vector<std::vector<std::string>>> schedule_data{};
+	// an empty cell for each hour of each day.
+	for (const std::string& day : days) { schedule_data[day] = std::vector<std::vector<std::string>>(hours_size); }
+	populate_schedule_data(schedule_data, hours_size);
+	return schedule_data;
+}
+
+void Schedule::populate_schedule_data(
+	std::unordered_map<std::string, std::vector<std::vector<std::string>>>& schedule_data,
+	const unsigned hours_size) const {
+	const Symbol_Table& table = Symbol_Table::get_instance();
+	for (const auto& [handle, course_types] : m_courses) {
+		for (const Course_Type* course_type : course_types) {
+			add_course_type_to_schedule(schedule_data, table.get_id(handle), course_type, hours_size);
+		}
+	}
+}
+
+void Schedule::add_course_type_to_schedule(
+	std::unordered_map<std::string, std::vector<std::vector<std::string>>>& schedule_data,
+	const std::string& course_id, const Course_Type* course_type, const unsigned hours_size) {
+	const std::tm start_time = course_type->get_start_time();
+	const int start_hour = start_time.tm_hour;
+	int end_hour = (start_hour * 60 + start_time.tm_min + static_cast<int>(course_type->get_duration())) / 60;
+	// a course type shorter than an hour still takes the cell of its hour.
+	if (end_hour == start_hour) { end_hour = start_hour + 1; }
+	// the table has the hours 7:00 - 21:00.
+	if (course_type->get_duration() == 0 || start_hour > 21) { return; }
+	std::vector<std::vector<std::string>>& day_data = schedule_data[course_type->get_day()];
+	for (int hour = start_hour; hour < end_hour && hour <= 21; hour++) {
+		const unsigned index = static_cast<unsigned>(hour - 7);
+		if (index < hours_size && index < day_data.size()) {
+			day_data[index].push_back(course_id + " " + course_type->get_type() + " " + course_type->get_classroom());
+		}
+	}
+}
+
+void Schedule::print_header(std::ostringstream& out, const std::vector<std::string>& days) {
+	out << std::setw(8) << "Time";
+	for (const std::string& day : days) { out << " | " << std::setw(20) << std::left << day; }
+	out << "\n" << std::string(days.size() * 23 + 8, '-') << std::endl;
+}
+
+unsigned Schedule::get_max_courses_for_hour(
+	const std::unordered_map<std::string, std::vector<std::vector<std::string>>>& schedule_data,
+	const std::vector<std::string>& days, const unsigned hour_index) {
+	size_t max_courses{};
+	for (const std::string& day : days) {
+		const std::vector<std::vector<std::string>>& day_data = schedule_data.at(day);
+		if (hour_index < day_data.size()) { max_courses = std::max(max_courses, day_data[hour_index].size()); }
+	}
+	return static_cast<unsigned>(max_courses);
+}
+
+void Schedule::print_schedule_body(std::ostringstream& out,
+                                   const std::unordered_map<std::string, std::vector<std::vector<std::string>>>&
+                                   schedule_data,
+                                   const std::vector<std::string>& days, const std::vector<unsigned>& hours) {
+	// get the cell of a day and an hour (nullptr if there is none).
+	auto get_cell = [&schedule_data](const std::string& day, const unsigned index) -> const std::vector<std::string>* {
+		const auto it = schedule_data.find(day);
+		if (it == schedule_data.end() || index >= it->second.size()) { return nullptr; }
+		return &it->second[index];
+	};
+	for (const unsigned hour : hours) {
+		const unsigned index = hour - 7;
+		out << std::setw(5) << std::right << hour << ":00";
+		const unsigned max_courses = get_max_courses_for_hour(schedule_data, days, index);
+		// the first line of the hour has the hour and the first course of each day.
+		for (const std::string& day : days) {
+			out << " | ";
+			const std::vector<std::string>* cell = get_cell(day, index);
+			if (cell && !cell->empty()) { out << std::setw(20) << std::left << cell->front(); }
+			else { out << std::setw(20) << ""; }
+		}
+		out << "\n";
+		// the overlapping courses of the hour are printed in more lines.
+		for (unsigned i = 1; i < max_courses; i++) {
+			out << std::setw(8) << "";
+			for (const std::string& day : days) {
+				out << " | ";
+				const std::vector<std::string>* cell = get_cell(day, index);
+				if (cell && i < cell->size()) { out << std::setw(20) << std::left << (*cell)[i]; }
+				else { out << std::setw(20) << ""; }
+			}
+			out << "\n";
+		}
+		out << std::string(days.size() * 23 + 8, '-') << "\n";
+	}
+}
+
+std::string Schedule::to_string() const {
+	std::ostringstream out{};
+	const std::vector<std::string> days{"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+	const std::vector<unsigned> hours{7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21};
+	const auto schedule_data = create_schedule_Data(days, static_cast<unsigned>(hours.size()));
+	print_header(out, days);
+	print_schedule_body(out, schedule_data, days, hours);
+	return out.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const Schedule& schedule) {
+	os << schedule.to_string();
+	return os;
+}
@@ -0,0 +1,189 @@
+#include "../../include/schedule/Schedule_Manager.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../include/CSV_Editor.h"
+
+Schedule_Manager::Schedule_Manager(const std::string& id) : m_student_id{id} {
+	try { read_schedules(); }
+	catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+}
+
+Schedule_Manager::Schedule_Manager(const Schedule_Manager& other) : m_student_id{other.m_student_id},
+                                                                    m_schedules{other.m_schedules},
+                                                                    m_id_counter{other.m_id_counter} {}
+
+Schedule_Manager::~Schedule_Manager() {
+	try { write_schedules(); }
+	catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+}
+
+void Schedule_Manager::read_schedules() {
+	try {
+		// each row of the student schedules file is a schedule.
+		const std::vector<std::vector<std::string>> data = CSV_Editor::read_csv(m_student_id + "_schedules.csv");
+		m_schedules.clear();
+		for (const std::vector<std::string>& row : data) { m_schedules.push_back(Schedule::from_csv(row)); }
+		reset_schedule_ids();
+	}
+	catch (const std::exception& e) {
+		// log the error and throw the exception again.
+		std::cerr << "Error in reading schedules: " << e.what() << std::endl;
+		throw;
+	}
+}
+
+void Schedule_Manager::write_schedules() {
+	try {
+		std::vector<std::vector<std::string>> data{};
+		for (const Schedule& schedule : m_schedules) { data.push_back(schedule.to_csv()); }
+		CSV_Editor::write_csv(m_student_id + "_schedules.csv", data);
+	}
+	catch (const std::exception& e) {
+		// log the error and throw the exception again.
+		std::cerr << "Error in writing schedules: " << e.what() << std::endl;
+		throw;
+	}
+}
+
+void Schedule_Manager::reset_schedule_ids() {
+	// the schedules are numbered from 1 in their order.
+	for (size_t i = 0; i < m_schedules.size(); i++) { m_schedules[i].set_id(static_cast<unsigned>(i + 1)); }
+	m_id_counter = static_cast<unsigned>(m_schedules.size());
+}
+
+void Schedule_Manager::check_schedules() const {
+	if (m_schedules.empty()) { throw std::runtime_error("No schedules available."); }
+}
+
+Schedule& Schedule_Manager::get_schedule(const unsigned id) {
+	return const_cast<Schedule&>(static_cast<const Schedule_Manager&>(*this).get_schedule(id));
+}
+
+const Schedule& Schedule_Manager::get_schedule(const unsigned id) const {
+	check_schedules();
+	if (id == 0 || id > m_schedules.size()) {
+		throw std::invalid_argument("Schedule id " + std::to_string(id) + " out of bounds.");
+	}
+	return m_schedules[id - 1];
+}
+
+bool Schedule_Manager::print(const std::string& id) const {
+	try {
+		check_schedules();
+		std::cout << get_schedule(static_cast<unsigned>(std::stoi(id))) << std::endl;
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing schedule with id " << id << ": " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::print_all() const {
+	try {
+		check_schedules();
+		for (const Schedule& schedule : m_schedules) {
+			std::cout << "Schedule id: " << schedule.get_id() << " : " << m_id_counter << std::endl
+				<< schedule << std::endl;
+		}
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing schedules: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::add_schedule() {
+	try {
+		m_schedules.emplace_back(++m_id_counter);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error adding schedule: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::rm_schedule(const std::string& id) {
+	try {
+		check_schedules();
+		const unsigned schedule_id = static_cast<unsigned>(std::stoi(id));
+		const auto it = std::find_if(m_schedules.begin(), m_schedules.end(), [schedule_id](const Schedule& schedule) {
+			return schedule.get_id() == schedule_id;
+		});
+		if (it == m_schedules.end()) { throw std::invalid_argument("Schedule with id " + id + " not found."); }
+		m_schedules.erase(it);
+		// the schedules after the removed one are numbered again.
+		reset_schedule_ids();
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error removing schedule: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::add_course(const std::string& id, const std::string& course_id, const std::string& group_id) {
+	try {
+		get_schedule(static_cast<unsigned>(std::stoi(id))).add_course_type(course_id, group_id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error adding course to schedule " << id << ": " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::rm_course(const std::string& id, const std::string& course_id, const std::string& group_id) {
+	try {
+		get_schedule(static_cast<unsigned>(std::stoi(id))).remove_course_type(course_id, group_id);
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error removing course from schedule " << id << ": " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::search(const std::string& course_id) const {
+	try {
+		check_schedules();
+		// search all schedules, each prints its own matches.
+		bool found{false};
+		for (const Schedule& schedule : m_schedules) { found = schedule.search(course_id) || found; }
+		if (!found) {
+			std::cerr << "No results found for course id: " << course_id << " in all schedules." << std::endl;
+		}
+		return found;
+	}
+	catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::print_weekly_summary(const std::string& id) const {
+	try {
+		get_schedule(static_cast<unsigned>(std::stoi(id))).print_weekly_summary();
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error printing weekly summary for schedule: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+bool Schedule_Manager::check_overlapping_courses(const std::string& id) const {
+	try {
+		get_schedule(static_cast<unsigned>(std::stoi(id))).print_overlapping_courses();
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error checking overlapping courses for schedule: " << e.what() << std::endl;
+		return false;
+	}
+}
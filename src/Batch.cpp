@@ -0,0 +1,132 @@
+#include "../include/Batch.h"
+
+#include <cerrno>
+#include <iostream>
+
+#include <unistd.h>
+
+#include "../libs/SchedulerLib/include/System_Operations.h"
+#include "../include/CLI.h"
+#include "../include/users/User.h"
+
+Batch::Output_Buffer::Output_Buffer(const int fd, const size_t size) : m_fd{fd}, m_buffer(size) {
+	setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+}
+
+Batch::Output_Buffer::int_type Batch::Output_Buffer::overflow(const int_type ch) {
+	// the buffer is full, write it and start over.
+	write_buffer();
+	if (traits_type::eq_int_type(ch, traits_type::eof())) { return traits_type::not_eof(ch); }
+	*pptr() = traits_type::to_char_type(ch);
+	pbump(1);
+	return ch;
+}
+
+void Batch::Output_Buffer::write_buffer() {
+	const char* data = pbase();
+	size_t size = static_cast<size_t>(pptr() - pbase());
+	// continue after a partial write, the output is dropped if the file descriptor is closed.
+	while (size > 0) {
+		const ssize_t count = write(m_fd, data, size);
+		if (count < 0) {
+			if (errno == EINTR) { continue; }
+			break;
+		}
+		data += count;
+		size -= static_cast<size_t>(count);
+	}
+	setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+}
+
+Batch::Batch(std::istream& input) : m_input{input} {}
+
+Batch::~Batch() {
+	clean_up();
+}
+
+void Batch::clean_up() {
+	// delete the user object and avoid dangling pointer.
+	delete m_user;
+	m_user = nullptr;
+}
+
+bool Batch::run() {
+	// the output of the commands goes to the buffer instead of the buffer of std::cout, until the batch ends.
+	std::cout.flush();
+	Output_Buffer buffer{STDOUT_FILENO, output_buffer_size};
+	std::streambuf* const output = std::cout.rdbuf(&buffer);
+	try {
+		std::string input{};
+		while (m_running && std::getline(m_input, input)) {
+			m_line++;
+			if (!input.empty() && input.back() == '\r') { input.pop_back(); }
+			// skip the leading spaces (like std::ws in the CLI), the empty lines and the comments.
+			const size_t start = input.find_first_not_of(" \t");
+			if (start == std::string::npos || input[start] == '#') { continue; }
+			input.erase(0, start);
+
+			const std::vector query{CLI::split_input(input)};
+			if (!m_user) {
+				const bool logged_in = login(query);
+				report("Login", logged_in);
+				// the commands after a failed login would run as nobody, so the batch stops.
+				if (!logged_in) {
+					std::cerr << "Error: invalid login on line " << m_line << "." << std::endl;
+					break;
+				}
+				continue;
+			}
+			// the first argument is the command and the rest are the arguments.
+			const std::string command{CLI::change_command_case(query[0])};
+			const std::vector<std::string> args{query.begin() + 1, query.end()};
+			report(command, run_command(command, args));
+		}
+		// save the catalog (and its snapshot for a fast startup), like Exit in the CLI.
+		System_Operations::checkpoint();
+		std::cout << "@summary\t" << m_commands << '\t' << m_failed << '\n';
+	}
+	catch (...) {
+		buffer.write_buffer();
+		std::cout.rdbuf(output);
+		throw;
+	}
+	buffer.write_buffer();
+	std::cout.rdbuf(output);
+	return m_failed == 0;
+}
+
+bool Batch::login(const std::vector<std::string>& words) {
+	// the words are the answers of the CLI login questions.
+	if (words.size() == 2 && words[0] == "admin") {
+		m_user = CLI::create_user(words[0], "", words[1], m_admin_password);
+	}
+	else if (words.size() == 3 && words[0] == "student") {
+		m_user = CLI::create_user(words[0], words[1], words[2], m_admin_password);
+	}
+	return m_user != nullptr;
+}
+
+bool Batch::run_command(const std::string& command, const std::vector<std::string>& args) {
+	if (args.empty()) {
+		if (command == "Exit") {
+			m_running = false;
+			return true;
+		}
+		if (command == "Logout") {
+			clean_up();
+			return true;
+		}
+	}
+	// an error of one command does not stop the batch, it fails the command.
+	try { return m_user->execute(command, args); }
+	catch (const std::exception& e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+void Batch::report(const std::string& command, const bool succeeded) {
+	m_commands++;
+	if (!succeeded) { m_failed++; }
+	std::cout << "@status\t" << m_line << '\t' << (succeeded ? "ok" : "failed") << '\t' << command << '\n';
+}
@@ -1,13 +1,41 @@
 #include "../include/CLI.h"
 
+#include <fstream>
 #include <iostream>
 
+#include "../libs/SchedulerLib/include/Char_Scanner.h"
 #include "../libs/SchedulerLib/include/System_Operations.h"
+#include "../include/Batch.h"
+#include "../include/Server.h"
 #include "../include/users/Admin_User.h"
 #include "../include/users/Student_User.h"
 
-// main function to run the CLI.
-int main() {
+// main function to run the CLI, the server with --server [socket path] (see Server),
+// or the commands of a file (or of the standard input) with --batch [commands file] (see Batch).
+int main(const int argc, char* argv[]) {
+	if (argc > 1 && std::string{argv[1]} == "--batch") {
+		std::ifstream file{};
+		if (argc > 2) {
+			file.open(argv[2]);
+			if (!file) {
+				std::cerr << "Error: could not open file " << argv[2] << std::endl;
+				return 1;
+			}
+		}
+		Batch batch{argc > 2 ? static_cast<std::istream&>(file) : std::cin};
+		return batch.run() ? 0 : 1;
+	}
+	if (argc > 1 && std::string{argv[1]} == "--server") {
+		try {
+			Server server{argc > 2 ? argv[2] : Server::default_socket_path};
+			server.run();
+		}
+		catch (const std::exception& e) {
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+		return 0;
+	}
 	CLI cli{};
 	return 0;
 }
@@ -98,6 +126,8 @@ void CLI::process_command(const std::string& input) {
 	for (size_t i = 1; i < query.size(); i++) { args.push_back(query[i]); }
 	if (args.empty()) {
 		if (command == "Exit") {
+			// save the catalog (and its snapshot for a fast startup) before exiting.
+			System_Operations::checkpoint();
 			set_running(false);
 			clean_up();
 			return;
@@ -113,30 +143,40 @@ void CLI::process_command(const std::string& input) {
 
 std::vector<std::string> CLI::split_input(const std::string& input) {
 	std::vector<std::string> query{};
-	std::string words{};
-	// iterate over the string line and split it into commands.
-	for (const char c : input) {
-		// if there is a space, push the command into the vector and clear the command.
-		if (c == ' ') {
-			query.push_back(words);
-			words.clear();
-		}
-		else { words += c; }
-	}
+	size_t start{};
+	// find the spaces of the line and split it into commands.
+	Char_Scanner::for_each_match(input, ' ', ' ', [&](const size_t end) {
+		query.push_back(input.substr(start, end - start));
+		start = end + 1;
+	});
 	// push the last command into the vector.
-	query.push_back(words);
+	query.push_back(input.substr(start));
 	return query;
 }
 
-bool CLI::process_admin(const std::string& password) {
-	// check password.
-	if (password != admin_password) {
-		// log the error.
-		std::cerr << "Error: invalid password." << std::endl;
-		return false;
+User* CLI::create_user(const std::string& username, const std::string& id, const std::string& password,
+                       const std::string& admin_password) {
+	if (username == "admin") {
+		// check password.
+		if (password != admin_password) {
+			// log the error.
+			std::cerr << "Error: invalid password." << std::endl;
+			return nullptr;
+		}
+		return new Admin_User(password);
+	}
+	if (username == "student") {
+		// authenticate the student.
+		if (!System_Operations::authenticate_student(id, password)) { return nullptr; }
+		return new Student_User(id, password);
 	}
-	// create a new admin object and downcast it to admin.
-	m_user = new Admin_User(password);
+	return nullptr;
+}
+
+bool CLI::process_admin(const std::string& password) {
+	// create a new admin object, if the password is valid.
+	m_user = create_user("admin", "", password, admin_password);
+	if (!m_user) { return false; }
 	// check if the admin wants to change the password.
 	std::cout << "Do you want to change the password? (yes or no)" << std::endl;
 	std::string change{};
@@ -151,13 +191,9 @@ bool CLI::process_admin(const std::string& password) {
 }
 
 bool CLI::process_student(const std::string& id, const std::string& password) {
-	// authenticate the student.
-	if (!System_Operations::authenticate_student(id, password)) {
-		return false;
-	}
-	// create a new student object.
-	m_user = new Student_User(id, password);
-	return true;
+	// authenticate the student and create a new student object.
+	m_user = create_user("student", id, password, admin_password);
+	return m_user != nullptr;
 }
 
 bool CLI::is_running() const { return m_running; }
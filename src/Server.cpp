@@ -0,0 +1,407 @@
+#include "../include/Server.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../libs/SchedulerLib/include/System_Operations.h"
+#include "../include/CLI.h"
+#include "../include/users/User.h"
+
+Server::Output_Capture::Output_Capture(std::ostream& stream)
+	: m_cout{std::cout.rdbuf(stream.rdbuf())}, m_cerr{std::cerr.rdbuf(stream.rdbuf())} {}
+
+Server::Output_Capture::~Output_Capture() {
+	std::cout.rdbuf(m_cout);
+	std::cerr.rdbuf(m_cerr);
+}
+
+Server::Server(const std::string& socket_path) : m_socket_path{socket_path} {
+	// the destructor is not called if the constructor throws, so close what was created.
+	try { setup(); }
+	catch (...) {
+		clean_up();
+		throw;
+	}
+}
+
+Server::~Server() {
+	clean_up();
+}
+
+void Server::setup() {
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (m_socket_path.empty() || m_socket_path.size() >= sizeof(address.sun_path)) {
+		throw std::runtime_error("Error: invalid socket path " + m_socket_path);
+	}
+	std::memcpy(address.sun_path, m_socket_path.c_str(), m_socket_path.size() + 1);
+	const auto* socket_address = reinterpret_cast<const sockaddr*>(&address);
+
+	m_listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (m_listen_fd < 0) { throw std::runtime_error("Error: could not create socket " + m_socket_path); }
+	// remove the socket file of a server that did not clean up, but not the socket of a running server.
+	const int probe_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	const bool in_use = probe_fd >= 0 && connect(probe_fd, socket_address, sizeof(address)) == 0;
+	if (probe_fd >= 0) { close(probe_fd); }
+	if (in_use) { throw std::runtime_error("Error: a server is already running on socket " + m_socket_path); }
+	unlink(m_socket_path.c_str());
+	// the socket file is created for the user of the server only (0600), other users can not connect to it.
+	const mode_t mask = umask(S_IRWXG | S_IRWXO | S_IXUSR);
+	const int bound = bind(m_listen_fd, socket_address, sizeof(address));
+	umask(mask);
+	if (bound < 0) {
+		const int listen_fd = m_listen_fd;
+		m_listen_fd = -1; // the socket file is not ours, so clean_up() does not remove it.
+		close(listen_fd);
+		throw std::runtime_error("Error: could not bind socket " + m_socket_path);
+	}
+	if (listen(m_listen_fd, SOMAXCONN) < 0) {
+		throw std::runtime_error("Error: could not listen on socket " + m_socket_path);
+	}
+
+	m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if (m_epoll_fd < 0) { throw std::runtime_error("Error: could not create epoll instance"); }
+	watch(m_listen_fd, EPOLLIN);
+
+	// SIGINT and SIGTERM stop the event loop instead of the process, so the catalog is saved.
+	sigset_t signals{};
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGTERM);
+	sigprocmask(SIG_BLOCK, &signals, nullptr);
+	m_signal_fd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (m_signal_fd < 0) { throw std::runtime_error("Error: could not create signal file descriptor"); }
+	watch(m_signal_fd, EPOLLIN);
+}
+
+void Server::watch(const int fd, const uint32_t events) const {
+	epoll_event event{};
+	event.events = events;
+	event.data.fd = fd;
+	if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+		throw std::runtime_error("Error: could not watch file descriptor " + std::to_string(fd));
+	}
+}
+
+void Server::run() {
+	// load the catalog with its course types and indexes once, before the first session connects.
+	Entity_Manager::get_instance().prepare_concurrent_reads();
+	std::cout << "Server listening on " << m_socket_path << std::endl;
+
+	std::array<epoll_event, max_events> events{};
+	while (m_running) {
+		const int count = epoll_wait(m_epoll_fd, events.data(), max_events, -1);
+		if (count < 0) {
+			if (errno == EINTR) { continue; }
+			throw std::runtime_error("Error: could not wait for connections on socket " + m_socket_path);
+		}
+		bool accept{false};
+		for (size_t i = 0; i < static_cast<size_t>(count); i++) {
+			const int fd = events[i].data.fd;
+			if (fd == m_listen_fd) { accept = true; }
+			else if (fd == m_signal_fd) { m_running = false; }
+			else { handle_session(fd, events[i].events); }
+		}
+		// accept after the events of the sessions, a new connection may get the file descriptor of a closed one,
+		// and must not get the events of the closed one.
+		if (accept) { accept_sessions(); }
+	}
+	clean_up();
+	// save the catalog (and its snapshot for a fast startup) before exiting, like Exit in the CLI.
+	System_Operations::checkpoint();
+	std::cout << "Server stopped." << std::endl;
+}
+
+void Server::clean_up() {
+	for (auto& [fd, session] : m_sessions) {
+		delete session.user;
+		close(fd);
+	}
+	m_sessions.clear();
+	if (m_listen_fd >= 0) {
+		close(m_listen_fd);
+		unlink(m_socket_path.c_str());
+		m_listen_fd = -1;
+	}
+	if (m_epoll_fd >= 0) {
+		close(m_epoll_fd);
+		m_epoll_fd = -1;
+	}
+	if (m_signal_fd >= 0) {
+		close(m_signal_fd);
+		m_signal_fd = -1;
+	}
+}
+
+void Server::accept_sessions() {
+	while (true) {
+		const int fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (fd < 0) {
+			if (errno == EINTR) { continue; }
+			// no more waiting connections, else (like too many open files) they wait for the next round.
+			if (errno != EAGAIN && errno != EWOULDBLOCK) {
+				std::cerr << "Error accepting a connection: " << std::strerror(errno) << std::endl;
+			}
+			return;
+		}
+		try { watch(fd, EPOLLIN); }
+		catch (const std::exception& e) {
+			std::cerr << "Error accepting a connection: " << e.what() << std::endl;
+			close(fd);
+			continue;
+		}
+		Session& session = m_sessions.try_emplace(fd).first->second;
+		session.events = EPOLLIN;
+		session.output = "Welcome to the CLI. Please login to continue.\nchoose a user (admin or student):\n";
+		if (!send_output(fd, session)) {
+			close_session(fd);
+			continue;
+		}
+		update_events(fd, session);
+	}
+}
+
+void Server::handle_session(const int fd, const uint32_t events) {
+	const auto it = m_sessions.find(fd);
+	if (it == m_sessions.end()) { return; }
+	Session& session = it->second;
+
+	bool connected = (events & EPOLLERR) == 0;
+	if (connected && (events & (EPOLLIN | EPOLLHUP))) { connected = receive(fd, session); }
+	// run the lines that waited for the output of the lines before them to be sent.
+	while (connected) {
+		const size_t input_size = session.input.size();
+		process_input(session);
+		connected = send_output(fd, session);
+		if (session.input.size() == input_size || session.output_offset < session.output.size()) { break; }
+	}
+
+	const bool done = session.exited || (session.peer_closed && session.input.empty());
+	if (!connected || (done && session.output.empty())) {
+		close_session(fd);
+		return;
+	}
+	update_events(fd, session);
+}
+
+bool Server::receive(const int fd, Session& session) {
+	std::array<char, 4096> buffer{};
+	while (session.input.size() < max_input_size) {
+		const ssize_t count = recv(fd, buffer.data(), buffer.size(), 0);
+		if (count > 0) {
+			session.input.append(buffer.data(), static_cast<size_t>(count));
+			continue;
+		}
+		if (count == 0) {
+			session.peer_closed = true;
+			break;
+		}
+		if (errno == EINTR) { continue; }
+		return errno == EAGAIN || errno == EWOULDBLOCK;
+	}
+	// a line that does not fit the input is not a command of the CLI.
+	if (session.input.size() >= max_input_size && session.input.find('\n') == std::string::npos) {
+		std::cerr << "Error: line too long, closing connection " << fd << "." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Server::send_output(const int fd, Session& session) {
+	while (session.output_offset < session.output.size()) {
+		const ssize_t count = send(fd, session.output.data() + session.output_offset,
+		                           session.output.size() - session.output_offset, MSG_NOSIGNAL);
+		if (count < 0) {
+			if (errno == EINTR) { continue; }
+			if (errno != EAGAIN && errno != EWOULDBLOCK) { return false; }
+			// the client is slow, drop the sent output so the rest does not move on every append.
+			if (session.output_offset > session.output.size() / 2) {
+				session.output.erase(0, session.output_offset);
+				session.output_offset = 0;
+			}
+			return true;
+		}
+		session.output_offset += static_cast<size_t>(count);
+	}
+	session.output.clear();
+	session.output_offset = 0;
+	return true;
+}
+
+void Server::process_input(Session& session) {
+	size_t start{};
+	while (!session.exited && session.output.size() - session.output_offset < max_pending_output) {
+		size_t end = session.input.find('\n', start);
+		if (end == std::string::npos) {
+			// the last line of a client that is done sending may have no line break.
+			if (!session.peer_closed || start == session.input.size()) { break; }
+			end = session.input.size();
+		}
+		std::string_view line{session.input};
+		line = line.substr(start, end - start);
+		if (!line.empty() && line.back() == '\r') { line.remove_suffix(1); }
+		process_line(session, line);
+		start = std::min(end + 1, session.input.size());
+	}
+	session.input.erase(0, start);
+	// the lines after Exit are not run, like in the CLI.
+	if (session.exited) { session.input.clear(); }
+}
+
+void Server::process_line(Session& session, const std::string_view line) {
+	static constexpr std::string_view spaces{" \t"};
+	std::ostringstream output{};
+	{
+		const Output_Capture capture{output};
+		size_t start = line.find_first_not_of(spaces);
+		// the login answers are words (like std::cin >> answer in the CLI), so a line can answer a few questions.
+		while (start != std::string_view::npos && session.state != Session::State::commands) {
+			const size_t end = std::min(line.find_first_of(spaces, start), line.size());
+			process_login(session, std::string{line.substr(start, end - start)});
+			start = line.find_first_not_of(spaces, end);
+		}
+		// the rest of the line is a command (like std::getline(std::cin >> std::ws, input) in the CLI).
+		if (start != std::string_view::npos && session.state == Session::State::commands) {
+			process_command(session, std::string{line.substr(start)});
+		}
+	}
+	session.output += output.str();
+}
+
+void Server::process_login(Session& session, const std::string& answer) {
+	switch (session.state) {
+	case Session::State::user_type:
+		if (answer != "admin" && answer != "student") {
+			reject_login(session);
+			return;
+		}
+		session.user_type = answer;
+		if (answer == "student") {
+			// ask for the student id.
+			std::cout << "enter the student id:" << std::endl;
+			session.state = Session::State::student_id;
+			return;
+		}
+		// ask for the password.
+		std::cout << "enter the password:" << std::endl;
+		session.state = Session::State::password;
+		return;
+	case Session::State::student_id:
+		session.id = answer;
+		std::cout << "enter the password:" << std::endl;
+		session.state = Session::State::password;
+		return;
+	case Session::State::password:
+		{
+			// authenticate the user like the CLI, the sessions of other students may change the catalog.
+			const Entity_Manager::Read_Lock lock{Entity_Manager::get_instance().read_lock()};
+			session.user = CLI::create_user(session.user_type, session.id, answer, session.admin_password);
+		}
+		if (!session.user) {
+			reject_login(session);
+			return;
+		}
+		if (session.user_type == "admin") {
+			// check if the admin wants to change the password.
+			std::cout << "Do you want to change the password? (yes or no)" << std::endl;
+			session.state = Session::State::change_password;
+			return;
+		}
+		start_commands(session);
+		return;
+	case Session::State::change_password:
+		if (answer == "yes") {
+			std::cout << "enter the new password:" << std::endl;
+			session.state = Session::State::new_password;
+			return;
+		}
+		start_commands(session);
+		return;
+	case Session::State::new_password:
+		// the password of the admin is changed for the next logins of this session.
+		session.admin_password = answer;
+		start_commands(session);
+		return;
+	case Session::State::commands:
+		return;
+	}
+}
+
+void Server::reject_login(Session& session) {
+	std::cout << "Invalid username or password. Please try again." << std::endl;
+	std::cout << "choose a user (admin or student):" << std::endl;
+	session.state = Session::State::user_type;
+}
+
+void Server::start_commands(Session& session) {
+	std::cout << "Enter a command (case insensitive) or type 'Help' for more information." << std::endl;
+	std::cout << "> ";
+	session.state = Session::State::commands;
+}
+
+void Server::process_command(Session& session, const std::string& input) {
+	const std::vector query{CLI::split_input(input)};
+	// the first argument is the command and the rest are the arguments.
+	const std::string command{CLI::change_command_case(query[0])};
+	const std::vector<std::string> args{query.begin() + 1, query.end()};
+	if (args.empty()) {
+		if (command == "Exit") {
+			// save the catalog like the CLI, but only the session exits, the server serves the other sessions.
+			System_Operations::checkpoint();
+			session.exited = true;
+			return;
+		}
+		if (command == "Logout") {
+			// delete the user object and avoid dangling pointer.
+			delete session.user;
+			session.user = nullptr;
+			std::cout << "Logged out." << std::endl << std::endl;
+			std::cout << "choose a user (admin or student):" << std::endl;
+			session.state = Session::State::user_type;
+			return;
+		}
+	}
+	// an error of one command must not stop the server, so it is logged to the session.
+	try { session.user->execute(command, args); }
+	catch (const std::exception& e) { std::cerr << "Error: " << e.what() << std::endl; }
+	std::cout << std::endl << "> ";
+}
+
+void Server::update_events(const int fd, Session& session) const {
+	uint32_t events{};
+	if (session.output_offset < session.output.size()) { events |= EPOLLOUT; }
+	// stop reading while the session can not run the commands it has.
+	if (!session.peer_closed && !session.exited && session.input.size() < max_input_size &&
+		session.output.size() - session.output_offset < max_pending_output) { events |= EPOLLIN; }
+	if (events == session.events) { return; }
+	epoll_event event{};
+	event.events = events;
+	event.data.fd = fd;
+	epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event);
+	session.events = events;
+}
+
+void Server::close_session(const int fd) {
+	const auto it = m_sessions.find(fd);
+	if (it == m_sessions.end()) { return; }
+	// delete the user object and avoid dangling pointer.
+	delete it->second.user;
+	m_sessions.erase(it);
+	// closing the connection removes it from the epoll instance.
+	close(fd);
+}
@@ -0,0 +1,113 @@
+// Client of the server mode (see Server), it connects to the socket of the server,
+// sends the lines of the standard input and prints the output of the session, so a session looks like the CLI.
+// usage: FinalProjectClient [socket path]
+// a client can be scripted, like many simulated students:
+// for i in $(seq 300); do printf 'student\n123456789\npassword\nPrintcourse\nExit\n' | FinalProjectClient & done
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../../include/Server.h"
+
+// connect to the socket of the server, returns the file descriptor (-1 if it fails).
+static int connect_server(const std::string& path) {
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (path.empty() || path.size() >= sizeof(address.sun_path)) { return -1; }
+	std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+	const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) { return -1; }
+	if (connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+// write a buffer to a file descriptor, continues after a partial write, false if the write fails.
+static bool write_all(const int fd, const char* data, size_t size) {
+	while (size > 0) {
+		const ssize_t count = write(fd, data, size);
+		if (count < 0) {
+			if (errno == EINTR) { continue; }
+			return false;
+		}
+		data += count;
+		size -= static_cast<size_t>(count);
+	}
+	return true;
+}
+
+// main function to run the client.
+int main(const int argc, char* argv[]) {
+	const std::string path{argc > 1 ? argv[1] : Server::default_socket_path};
+	const int server_fd = connect_server(path);
+	if (server_fd < 0) {
+		std::cerr << "Error: could not connect to server " << path << ": " << std::strerror(errno) << std::endl;
+		return 1;
+	}
+
+	std::array<char, 4096> buffer{};
+	std::string pending{}; // input that the server did not take yet.
+	size_t pending_offset{};
+	bool input_open{true};
+	// the input is not read while the server does not take it, and the output is read meanwhile,
+	// so a client that sends a lot of commands does not block a server that waits for it to read the output.
+	while (true) {
+		const bool has_pending = pending_offset < pending.size();
+		std::array<pollfd, 2> fds{};
+		fds[0] = {input_open && !has_pending ? STDIN_FILENO : -1, POLLIN, 0};
+		fds[1] = {server_fd, static_cast<short>(POLLIN | (has_pending ? POLLOUT : 0)), 0};
+		if (poll(fds.data(), fds.size(), -1) < 0) {
+			if (errno == EINTR) { continue; }
+			std::cerr << "Error: could not wait for the server: " << std::strerror(errno) << std::endl;
+			break;
+		}
+
+		// print the output of the session, until the server closes the connection.
+		if (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) {
+			const ssize_t count = recv(server_fd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+			if (count == 0) { break; }
+			if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+				std::cerr << "Error: connection to server lost: " << std::strerror(errno) << std::endl;
+				break;
+			}
+			if (count > 0 && !write_all(STDOUT_FILENO, buffer.data(), static_cast<size_t>(count))) { break; }
+		}
+
+		// send the input the server did not take yet.
+		if (has_pending && (fds[1].revents & POLLOUT)) {
+			const ssize_t count = send(server_fd, pending.data() + pending_offset, pending.size() - pending_offset,
+			                           MSG_DONTWAIT | MSG_NOSIGNAL);
+			if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+				std::cerr << "Error: connection to server lost: " << std::strerror(errno) << std::endl;
+				break;
+			}
+			if (count > 0) { pending_offset += static_cast<size_t>(count); }
+			if (pending_offset == pending.size()) {
+				pending.clear();
+				pending_offset = 0;
+			}
+		}
+
+		// read the input, at the end of it tell the server that the client is done sending.
+		if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+			const ssize_t count = read(STDIN_FILENO, buffer.data(), buffer.size());
+			if (count > 0) { pending.assign(buffer.data(), static_cast<size_t>(count)); }
+			else if (count == 0 || errno != EINTR) {
+				input_open = false;
+				shutdown(server_fd, SHUT_WR);
+			}
+		}
+	}
+	close(server_fd);
+	return 0;
+}
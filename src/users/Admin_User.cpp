@@ -11,9 +11,20 @@ Admin_User::Admin_User(const Admin_User& other) : User(other) {}
 bool Admin_User::execute(const std::string& command, const std::vector<std::string>& args) {
 	// check the shared commands.
 	bool found{true};
-	try { User::execute(command, args); }
+	bool result{}; // result of a shared command.
+	try { result = User::execute(command, args); }
 	catch (const std::invalid_argument&) { found = false; } // catch the error and continue.
 
+	// search only reads the catalog, the other admin commands change it, so they lock it exclusively.
+	if (command == "Search") {
+		const Entity_Manager::Read_Lock lock{Entity_Manager::get_instance().read_lock()};
+		return validate_arg_size(args.size(), 1, command) &&
+			System_Operations::search(args[0]);
+	}
+	// the changes of the command are published to the readers of versions when the lock is released.
+	Entity_Manager::Write_Lock lock{};
+	if (!found) { lock = Entity_Manager::get_instance().write_lock(); }
+
 	if (command == "Addcourse") {
 		return validate_arg_size(args.size(), 4, command) && System_Operations::add_course(
 			args[0], args[1], args[2], args[3]);
@@ -38,10 +49,6 @@ bool Admin_User::execute(const std::string& command, const std::vector<std::stri
 		return validate_arg_size(args.size(), 1, command) &&
 			System_Operations::rm_student(args[0]);
 	}
-	if (command == "Search") {
-		return validate_arg_size(args.size(), 1, command) &&
-			System_Operations::search(args[0]);
-	}
 	if (command == "Addlecture") {
 		return validate_arg_size(args.size(), 7, command) &&
 			System_Operations::add_course_type<Lecture>(args[0], args[1], args[2],
@@ -66,7 +73,7 @@ bool Admin_User::execute(const std::string& command, const std::vector<std::stri
 	}
 	// command not found, log error.
 	if (!found) { std::cerr << "Error: command not found: " << command << std::endl; }
-	return false;
+	return found && result;
 }
 
 void Admin_User::help() const {
@@ -14,7 +14,8 @@ bool Student_User::execute(const std::string& command, const std::vector<std::st
 	if (is_schedule_menu) { return schedule_execute(command, args); }
 	// then check the shared commands.
 	bool found{true};
-	try { User::execute(command, args); }
+	bool result{}; // result of a shared command.
+	try { result = User::execute(command, args); }
 	catch (const std::invalid_argument&) { found = false; } // catch the error and continue.
 	if (command == "Schedule") {
 		if (validate_arg_size(args.size(), 0, command)) {
@@ -25,10 +26,12 @@ bool Student_User::execute(const std::string& command, const std::vector<std::st
 	}
 	// command not found, log error.
 	if (!found) { std::cerr << "Error: command not found: " << command << std::endl; }
-	return false;
+	return found && result;
 }
 
 bool Student_User::schedule_execute(const std::string& command, const std::vector<std::string>& args) {
+	// the schedules are kept by the students of the catalog, so the schedule commands lock it exclusively.
+	const Entity_Manager::Write_Lock lock{Entity_Manager::get_instance().write_lock()};
 	if (command == "Help") {
 		help();
 		return true;
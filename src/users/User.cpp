@@ -6,7 +6,7 @@
 
 User::User(const std::string& password) : m_password{password} {}
 
-User::User(const User& other) : m_password{other.m_password} {}
+User::User(const User& other) : m_password{other.m_password}, m_page_cursor{other.m_page_cursor} {}
 
 bool User::execute(const std::string& command, const std::vector<std::string>& args) {
 	// shared commands for all users.
@@ -19,8 +19,23 @@ bool User::execute(const std::string& command, const std::vector<std::string>& a
 	if (command == "Clear") {
 		return validate_arg_size(args.size(), 0, command) && (clear_screen(), true);
 	}
+	// the listings print a pinned version of the catalog, so they do not lock it (see Catalog_Version).
+	if (command == "Printcourse" && args.empty()) { return System_Operations::print_courses(m_page_cursor); }
+	if (command == "Printallcourses") {
+		return validate_arg_size(args.size(), 0, command) && System_Operations::print_all_courses();
+	}
+	if (command == "Printalllecturers") {
+		return validate_arg_size(args.size(), 0, command) && System_Operations::print_teachers(m_page_cursor, all_page_size);
+	}
+	if (command == "Printallstudents") {
+		return validate_arg_size(args.size(), 0, command) && System_Operations::print_students(m_page_cursor, all_page_size);
+	}
+	if (command == "More") {
+		return validate_arg_size(args.size(), 0, command) && System_Operations::print_more(m_page_cursor);
+	}
+	// the other shared commands only read the catalog, so they run in parallel with the commands of other sessions.
+	const Entity_Manager::Read_Lock lock{Entity_Manager::get_instance().read_lock()};
 	if (command == "Printcourse") {
-		if (args.empty()) { return System_Operations::print_courses(10, true); }
 		return validate_arg_size(args.size(), 1, command) && System_Operations::print_course(args[0]);
 	}
 	if (command == "Printlecturer") {
@@ -29,17 +44,9 @@ bool User::execute(const std::string& command, const std::vector<std::string>& a
 	if (command == "Printstudent") {
 		return validate_arg_size(args.size(), 1, command) && System_Operations::print_student(args[0]);
 	}
-	if (command == "Printallcourses") {
-		return validate_arg_size(args.size(), 0, command) && System_Operations::print_all_courses();
-	}
-	if (command == "Printalllecturers") {
-		return validate_arg_size(args.size(), 0, command) && System_Operations::print_all_teachers();
-	}
-	if (command == "Printallstudents") {
-		return validate_arg_size(args.size(), 0, command) && System_Operations::print_all_students();
-	}
-	if (command == "More") {
-		return validate_arg_size(args.size(), 0, command) && System_Operations::print_more_courses();
+	if (command == "Complete") {
+		if (args.size() == 2) { return System_Operations::complete(args[0], args[1]); }
+		return validate_arg_size(args.size(), 1, command) && System_Operations::complete(args[0]);
 	}
 	// if a command was not found, throw an error.
 	throw std::invalid_argument("Command: " + command + " was not found.");
@@ -53,9 +60,14 @@ void User::help() const {
 	std::cout << "Logout - logout from the system." << std::endl;
 	std::cout << "Exit - exit the system." << std::endl;
 	std::cout << "Print(Course/lecturer/student) [id] - print the entity with the given id." << std::endl;
-	std::cout << "Printall(Courses/lecturers/students) - print all entities of specific type." << std::endl;
-	std::cout << "Print - print the the first 10 courses." << std::endl;
-	std::cout << "More - print 10 more courses. (if available)" << std::endl;
+	std::cout << "Printallcourses - print all courses." << std::endl;
+	std::cout << "Printall(lecturers/students) - print the first " << all_page_size
+		<< " entities of specific type." << std::endl;
+	std::cout << "Printcourse - print the the first 10 courses." << std::endl;
+	std::cout << "More - print the next page of the last listing (courses, lecturers or students). (if available)"
+		<< std::endl;
+	std::cout << "Complete [prefix] [limit] - complete course ids, course names and lecturers (default limit 10)."
+		<< std::endl;
 }
 
 void User::clear_screen() {
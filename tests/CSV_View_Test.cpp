@@ -0,0 +1,90 @@
+#include "Test.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "CSV_View.h"
+
+// collect the rows of a mapped file as strings (the views are only valid while the view is alive).
+static std::vector<std::vector<std::string>> read_rows(const CSV_View& view) {
+	std::vector<std::vector<std::string>> rows{};
+	view.for_each_row([&rows](const std::vector<std::string_view>& row) {
+		rows.emplace_back(row.begin(), row.end());
+	});
+	return rows;
+}
+
+// write raw data to a file of the resources directory.
+static void write_resource(const std::string& file_name, const std::string& data) {
+	std::ofstream file(CSV_Editor::get_path(file_name), std::ios::binary | std::ios::trunc);
+	file << data;
+}
+
+int main() {
+	const std::string file_name = "test_csv_view.csv";
+
+	// rows and cells, windows line endings and empty lines, no line break at the end.
+	write_resource(file_name, "10000,Algebra,123456789,5.0\r\n\n10001,,Bob,2.5\n20000,Physics,987654321,4");
+	{
+		const CSV_View view = CSV_View::map(file_name);
+		const std::vector<std::vector<std::string>> rows = read_rows(view);
+		test::check(rows.size() == 3, "three rows are read, the empty line is skipped");
+		if (rows.size() == 3) {
+			test::check(rows[0] == std::vector<std::string>{"10000", "Algebra", "123456789", "5.0"},
+			            "the carriage return is not part of the last cell");
+			test::check(rows[1].size() == 4 && rows[1][1].empty(), "an empty cell is kept");
+			test::check(rows[2].back() == "4", "the last row is read without a line break");
+		}
+	}
+
+	// an empty file is an empty view.
+	write_resource(file_name, "");
+	{
+		const CSV_View view = CSV_View::map(file_name);
+		test::check(view.get_data().empty(), "an empty file maps to an empty view");
+		test::check(read_rows(view).empty(), "an empty file has no rows");
+	}
+
+	// a moved view owns the mapping, the moved from view is empty.
+	write_resource(file_name, "a,b\n");
+	{
+		CSV_View view = CSV_View::map(file_name);
+		const CSV_View moved{std::move(view)};
+		test::check(view.get_data().empty(), "the moved from view is empty");
+		test::check(moved.get_data() == "a,b\n", "the moved view has the data");
+	}
+
+	// a byte order mark at the start of the file is not part of the first cell.
+	write_resource(file_name, "\xEF\xBB\xBF" "10000,Algebra\n10001,Physics\n");
+	{
+		const CSV_View view = CSV_View::map(file_name);
+		const std::vector<std::vector<std::string>> rows = read_rows(view);
+		test::check(!rows.empty() && rows[0][0] == "10000", "the byte order mark of a mapped file is skipped");
+	}
+	// the first chunk of a streamed file may be shorter than the byte order mark.
+	for (const size_t chunk_size : {size_t{1}, size_t{64}}) {
+		std::vector<std::vector<std::string>> rows{};
+		CSV_Editor::stream_csv(file_name, [&rows](const std::vector<std::string_view>& row) {
+			rows.emplace_back(row.begin(), row.end());
+		}, chunk_size);
+		test::check(rows.size() == 2 && rows[0][0] == "10000" && rows[1][0] == "10001",
+		            "the byte order mark of a streamed file is skipped");
+	}
+
+	// a missing file is created empty, like CSV_Editor::read_csv does.
+	test::remove_resource(file_name);
+	{
+		const CSV_View view = CSV_View::map(file_name);
+		test::check(view.get_data().empty(), "a missing file maps to an empty view");
+		test::check(std::ifstream{CSV_Editor::get_path(file_name)}.is_open(), "mapping a missing file creates it");
+	}
+	test::remove_resource(file_name);
+	size_t row_count{};
+	CSV_Editor::stream_csv(file_name, [&row_count](const std::vector<std::string_view>&) { ++row_count; });
+	test::check(row_count == 0, "a missing file streams no rows");
+	test::check(std::ifstream{CSV_Editor::get_path(file_name)}.is_open(), "streaming a missing file creates it");
+	test::remove_resource(file_name);
+
+	return test::result("CSV_View");
+}
@@ -0,0 +1,142 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Catalog_Snapshot.h"
+#include "Entity_Manager.h"
+#include "Journal.h"
+
+// number of courses that the writer does not add or remove, and the course it adds and removes.
+static constexpr int course_count = 200;
+static const std::string writer_course_id = "20000";
+// the course the writer adds a lecture to and removes it from, with the writer course.
+static const std::string shared_course_id = "10000";
+static const std::string shared_group_id = "02";
+// how long the readers read while the writer changes the catalog.
+static constexpr std::chrono::milliseconds run_time{200};
+
+static std::string make_course_id(const int i) { return std::to_string(10000 + i); }
+
+static Lecture* make_lecture(const std::string& group_id) {
+	return new Lecture(group_id, "Sunday", "10:00", 90, "Bob", "A101");
+}
+
+// the ids, names and group ids of the courses of a version, in order.
+static std::vector<std::string> describe_courses(const Catalog_Version& version) {
+	std::vector<std::string> courses{};
+	for (const auto& item : version.get_entities<Course>()) {
+		std::string course{item.entity->get_id_view()};
+		course += ',';
+		course += item.entity->get_name_view();
+		std::vector<std::string> group_ids{};
+		item.entity->for_each_course_type([&group_ids](const Course_Type& course_type) {
+			group_ids.emplace_back(course_type.get_id_view());
+		});
+		std::sort(group_ids.begin(), group_ids.end());
+		for (const std::string& group_id : group_ids) { course += ',' + group_id; }
+		courses.push_back(course);
+	}
+	return courses;
+}
+
+// check that a version has the changes of the writer whole or not at all.
+static bool is_consistent(const Catalog_Version& version) {
+	const Course* shared_course{};
+	const Course* writer_course{};
+	size_t size{};
+	for (const auto& item : version.get_entities<Course>()) {
+		if (item.entity->get_id_view() == shared_course_id) { shared_course = item.entity; }
+		if (item.entity->get_id_view() == writer_course_id) { writer_course = item.entity; }
+		++size;
+	}
+	if (!shared_course || size != course_count + (writer_course ? 1 : 0)) { return false; }
+	const bool has_group = shared_course->get_course_type(shared_group_id) != nullptr;
+	return has_group == (writer_course != nullptr) && (!writer_course || writer_course->get_course_type("01"));
+}
+
+int main() {
+	for (const std::string& file_name : {Student::get_file_name(), Teacher::get_file_name(), Course::get_file_name(),
+	                                     Catalog_Snapshot::get_file_name(), Journal::get_file_name(),
+	                                     Journal::get_rotated_file_name()}) {
+		test::remove_resource(file_name);
+	}
+	Entity_Manager& manager = Entity_Manager::get_instance();
+	{
+		const Entity_Manager::Write_Lock lock{manager.write_lock()};
+		for (int i = 0; i < course_count; i++) {
+			Course* course = new Course(make_course_id(i), "Course " + std::to_string(i), "Bob", 2);
+			manager.add_entity<Course>(course);
+			manager.add_entity<Lecture>(make_lecture("01"), course);
+		}
+	}
+	manager.prepare_concurrent_reads();
+
+	// a pinned version does not change while the writer adds and removes courses and course types.
+	const std::shared_ptr<const Catalog_Version> pinned{manager.pin_version()};
+	const std::vector<std::string> expected = describe_courses(*pinned);
+	test::check(expected.size() == course_count, "the pinned version has the courses");
+
+	std::atomic<bool> stop{false};
+	std::atomic<size_t> changed_reads{};
+	std::atomic<size_t> inconsistent_reads{};
+	std::atomic<size_t> reads{};
+	std::vector<std::thread> threads{};
+	// a reader of the pinned version, and a reader that pins the latest version on every read.
+	threads.emplace_back([&] {
+		while (!stop.load(std::memory_order_relaxed)) {
+			if (describe_courses(*pinned) != expected) { ++changed_reads; }
+			++reads;
+		}
+	});
+	threads.emplace_back([&] {
+		while (!stop.load(std::memory_order_relaxed)) {
+			if (!is_consistent(*manager.pin_version())) { ++inconsistent_reads; }
+			++reads;
+		}
+	});
+	size_t writes{};
+	threads.emplace_back([&] {
+		while (!stop.load(std::memory_order_relaxed)) {
+			// each command adds or removes the writer course and the lecture of the shared course together.
+			const Entity_Manager::Write_Lock lock{manager.write_lock()};
+			Course* shared_course = manager.get_entity<Course>(shared_course_id);
+			if (Course* course = manager.get_entity<Course>(writer_course_id)) {
+				manager.remove_entity<Lecture>("01", course);
+				manager.remove_entity<Course>(writer_course_id);
+				manager.remove_entity<Lecture>(shared_group_id, shared_course);
+			}
+			else {
+				Course* added = new Course(writer_course_id, "Writer", "Bob", 2);
+				manager.add_entity<Course>(added);
+				manager.add_entity<Lecture>(make_lecture("01"), added);
+				manager.add_entity<Lecture>(make_lecture(shared_group_id), shared_course);
+			}
+			++writes;
+		}
+	});
+	std::this_thread::sleep_for(run_time);
+	stop = true;
+	for (std::thread& thread : threads) { thread.join(); }
+
+	test::check(reads > 0 && writes > 0, "the readers and the writer ran");
+	test::check(changed_reads == 0, "the pinned version does not change");
+	test::check(inconsistent_reads == 0, "a pinned version has the changes of a command whole or not at all");
+	test::check(describe_courses(*pinned) == expected, "the pinned version keeps its entities after the writes");
+
+	// leave the catalog without the changes of the writer.
+	const Entity_Manager::Write_Lock lock{manager.write_lock()};
+	if (Course* course = manager.get_entity<Course>(writer_course_id)) {
+		manager.remove_entity<Lecture>("01", course);
+		manager.remove_entity<Course>(writer_course_id);
+		manager.remove_entity<Lecture>(shared_group_id, manager.get_entity<Course>(shared_course_id));
+	}
+	test::check(manager.get_entity_order<Course>().size() == course_count, "the courses are kept");
+
+	return test::result("Catalog_Version");
+}
@@ -0,0 +1,109 @@
+#include "Test.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Catalog_Snapshot.h"
+#include "Entity_Manager.h"
+#include "Journal.h"
+
+// number of courses that are not changed by the writer, and the id of the course it adds and removes.
+static constexpr int course_count = 1000;
+static const std::string writer_course_id = "20000";
+// how long each round of the stress test runs.
+static constexpr std::chrono::milliseconds round_time{200};
+
+static std::string make_course_id(const int i) { return std::to_string(10000 + i); }
+
+// result of a round of the stress test.
+struct Round {
+	size_t reads{};
+	size_t writes{};
+	size_t errors{};
+};
+
+/**
+ * run reader threads that look up courses under the read lock, and one writer thread that adds and removes a course
+ * under the write lock (like the admin and the other sessions of the server).
+ * @param manager - the catalog.
+ * @param readers - number of reader threads.
+ * @return the number of reads, writes and inconsistent reads.
+ */
+static Round run_round(Entity_Manager& manager, const size_t readers) {
+	std::atomic<bool> stop{false};
+	std::atomic<size_t> reads{};
+	std::atomic<size_t> errors{};
+	size_t writes{};
+	std::vector<std::thread> threads{};
+	for (size_t reader = 0; reader < readers; reader++) {
+		threads.emplace_back([&manager, &stop, &reads, &errors, reader] {
+			size_t count{};
+			size_t inconsistent{};
+			for (int i = static_cast<int>(reader) * 7; !stop.load(std::memory_order_relaxed); i++) {
+				const Entity_Manager::Read_Lock lock{manager.read_lock()};
+				// a course that the writer does not change is always there.
+				const std::string id = make_course_id(i % course_count);
+				const Course* course = manager.get_entity<Course>(id);
+				if (!course || course->get_id_view() != id) { ++inconsistent; }
+				// the course of the writer is either added (in the store and the order) or removed (in neither).
+				const bool in_store = manager.get_entity<Course>(writer_course_id) != nullptr;
+				const size_t order_size = manager.get_entity_order<Course>().size();
+				if (order_size != course_count + (in_store ? 1 : 0)) { ++inconsistent; }
+				if (in_store != manager.has_entity(writer_course_id, Course::get_file_name())) { ++inconsistent; }
+				++count;
+			}
+			reads += count;
+			errors += inconsistent;
+		});
+	}
+	threads.emplace_back([&manager, &stop, &writes] {
+		while (!stop.load(std::memory_order_relaxed)) {
+			const Entity_Manager::Write_Lock lock{manager.write_lock()};
+			if (manager.get_entity<Course>(writer_course_id)) { manager.remove_entity<Course>(writer_course_id); }
+			else { manager.add_entity<Course>(new Course(writer_course_id, "Writer", "Bob", 2)); }
+			++writes;
+		}
+	});
+	std::this_thread::sleep_for(round_time);
+	stop = true;
+	for (std::thread& thread : threads) { thread.join(); }
+	return {reads.load(), writes, errors.load()};
+}
+
+int main() {
+	for (const std::string& file_name : {Student::get_file_name(), Teacher::get_file_name(), Course::get_file_name(),
+	                                     Catalog_Snapshot::get_file_name(), Journal::get_file_name(),
+	                                     Journal::get_rotated_file_name()}) {
+		test::remove_resource(file_name);
+	}
+	Entity_Manager& manager = Entity_Manager::get_instance();
+	{
+		const Entity_Manager::Write_Lock lock{manager.write_lock()};
+		for (int i = 0; i < course_count; i++) {
+			manager.add_entity<Course>(new Course(make_course_id(i), "Course " + std::to_string(i), "Bob", 2));
+		}
+	}
+	manager.prepare_concurrent_reads();
+
+	// read throughput as the readers scale (with one writer), the reads of a round are summed over its readers.
+	std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+	for (const size_t readers : {1, 2, 4, 8}) {
+		const Round round = run_round(manager, readers);
+		const double seconds = std::chrono::duration<double>(round_time).count();
+		std::cout << "readers: " << readers << ", reads per second: " << static_cast<size_t>(round.reads / seconds)
+			<< ", writes per second: " << static_cast<size_t>(round.writes / seconds) << std::endl;
+		test::check(round.errors == 0, std::to_string(readers) + " readers see every write whole");
+		test::check(round.reads > 0, std::to_string(readers) + " readers are not starved by the writer");
+		test::check(round.writes > 0, "the writer is not starved by " + std::to_string(readers) + " readers");
+	}
+
+	// leave the catalog without the course of the writer.
+	const Entity_Manager::Write_Lock lock{manager.write_lock()};
+	if (manager.get_entity<Course>(writer_course_id)) { manager.remove_entity<Course>(writer_course_id); }
+	test::check(manager.get_entity_order<Course>().size() == course_count, "the courses are kept");
+
+	return test::result("Concurrent_Reads");
+}
@@ -0,0 +1,54 @@
+#include "Test.h"
+
+#include <string>
+#include <vector>
+
+#include "Entity_Order.h"
+
+// get the ids of the order as a vector.
+static std::vector<std::string> get_ids(const Entity_Order& order) { return {order.begin(), order.end()}; }
+
+int main() {
+	Entity_Order order{};
+	for (int i = 0; i < 100; i++) { order.push_back("id" + std::to_string(i)); }
+	test::check(order.size() == 100, "all ids are added");
+	test::check(!order.push_back("id5"), "an id is added once");
+
+	// a cursor points at its id until the id is removed, then at the id after it.
+	const Entity_Order::Cursor cursor = order.find_cursor("id50");
+	test::check(*order.seek(cursor) == "id50", "seek returns the id of a cursor");
+	order.erase("id50");
+	test::check(!order.contains("id50"), "a removed id is not in the order");
+	test::check(*order.seek(cursor) == "id51", "the cursor of a removed id points at the next id");
+	test::check(order.find_cursor("id51") == cursor.next(), "the next cursor is the cursor of the next id");
+
+	// the cursors stay valid when the tombstones are dropped.
+	const Entity_Order::Cursor last = order.find_cursor("id99");
+	for (int i = 0; i < 80; i++) {
+		if (i != 50) { order.erase("id" + std::to_string(i)); }
+	}
+	test::check(order.size() == 20, "the removed ids are not counted");
+	test::check(*order.seek(cursor) == "id80", "a cursor stays valid after the compaction");
+	test::check(*order.seek(last) == "id99", "the cursor of an id stays valid after the compaction");
+	const Symbol_Table& table = Symbol_Table::get_instance();
+	test::check(order.get_position(table.find("id80")) < order.get_position(table.find("id99")),
+	            "the positions keep the order after the compaction");
+
+	// the iteration skips the removed ids and keeps the order.
+	const std::vector<std::string> ids = get_ids(order);
+	test::check(ids.size() == 20 && ids.front() == "id80" && ids.back() == "id99", "the ids are iterated in order");
+
+	// the cursor after the last id comes before the ids that are added later.
+	const Entity_Order::Cursor end = order.get_cursor(order.end());
+	order.push_back("new");
+	test::check(*order.seek(end) == "new", "an added id comes after the end cursor");
+	test::check(last < end, "the cursors are in the order of the ids");
+
+	// the cursors of the ids of a cleared order stay before the ids that are added again.
+	order.clear();
+	order.push_back("id0");
+	test::check(cursor < order.find_cursor("id0"), "an old cursor comes before a new id");
+	test::check(order.seek(Entity_Order::Cursor{}) != order.end(), "a default cursor is the start of the order");
+
+	return test::result("Entity_Order");
+}
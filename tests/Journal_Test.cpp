@@ -0,0 +1,62 @@
+#include "Test.h"
+
+#include <string>
+#include <vector>
+
+#include "Journal.h"
+
+// replay a journal and collect its records as strings.
+static std::vector<std::vector<std::string>> replay_records(Journal& journal) {
+	std::vector<std::vector<std::string>> records{};
+	journal.replay([&records](const std::vector<std::string_view>& record) {
+		records.emplace_back(record.begin(), record.end());
+	});
+	return records;
+}
+
+int main() {
+	test::remove_resource(Journal::get_file_name());
+	test::remove_resource(Journal::get_rotated_file_name());
+
+	// records are replayed in the order they were appended.
+	{
+		Journal journal{};
+		test::check(replay_records(journal).empty(), "a missing journal has no records");
+		journal.append('A', "Courses.csv", "", {"10000", "Algebra", "123456789", "5.000000"});
+		journal.append('A', "_lectures.csv", "10000", {"01", "Sunday", "10:00", "2", "Bob", "Room 1"});
+		journal.append('R', "Courses.csv", "", {"10000"}, CSV_Writer::Durability::fsync_file_and_dir);
+		test::check(journal.get_record_count() == 3, "the appended records are counted");
+	}
+	{
+		Journal journal{};
+		const std::vector<std::vector<std::string>> records = replay_records(journal);
+		test::check(records.size() == 3, "a new journal replays the records of the file");
+		test::check(journal.get_record_count() == 3, "the replayed records are counted");
+		if (records.size() == 3) {
+			test::check(records[0] == std::vector<std::string>{"A", "Courses.csv", "", "10000", "Algebra",
+			                                                   "123456789", "5.000000"}, "an add record is replayed");
+			test::check(records[1][2] == "10000", "the course id of a course type is replayed");
+			test::check(records[2] == std::vector<std::string>{"R", "Courses.csv", "", "10000"},
+			            "a remove record is replayed");
+		}
+
+		// a rotated journal is replayed before the records appended after the rotation.
+		journal.rotate();
+		test::check(journal.get_record_count() == 0, "a rotated journal has no records of its own");
+		journal.append('A', "Teachers.csv", "", {"123456789", "Bob"});
+		const std::vector<std::vector<std::string>> rotated = replay_records(journal);
+		test::check(rotated.size() == 4, "the rotated and the new records are replayed");
+		test::check(!rotated.empty() && rotated.back()[1] == "Teachers.csv", "the new records are replayed last");
+		test::check(journal.get_record_count() == 1, "only the new records are counted");
+
+		// a compaction removes the rotated journal once its records are in the csv files.
+		journal.remove_rotated();
+		test::check(replay_records(journal).size() == 1, "the rotated records are not replayed after the compaction");
+
+		journal.clear();
+		test::check(replay_records(journal).empty(), "a cleared journal has no records");
+	}
+
+	test::remove_resource(Journal::get_file_name());
+	return test::result("Journal");
+}
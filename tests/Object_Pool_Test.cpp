@@ -0,0 +1,45 @@
+#include "Test.h"
+
+#include <string>
+
+#include "Object_Pool.h"
+#include "data/Teacher.h"
+#include "data/course_types/Lab.h"
+#include "data/course_types/Lecture.h"
+
+// a type that is larger than the objects of its pool, like a derived type with more members.
+struct Large {
+	char data[512]{};
+};
+
+int main() {
+	// the entities are allocated from the pool of their type and their slots are reused.
+	Teacher* first = new Teacher("123456789", "Bob");
+	test::check(Object_Pool<Teacher>::get_instance().get_slab_count() == 1, "a teacher is allocated from its pool");
+	Teacher* second = new Teacher("987654321", "Ann");
+	test::check(reinterpret_cast<char*>(second) != reinterpret_cast<char*>(first), "the slots are not shared");
+	void* freed = first;
+	delete first;
+	Teacher* third = new Teacher("111111111", "Dan");
+	test::check(third == freed, "a freed slot is reused by the next allocation");
+	delete second;
+	delete third;
+
+	// course types are deleted through the base class, and go back to the Course_Type pool.
+	Course_Type* lecture = new Lecture("01", "Sunday", "10:00", 90, "Bob", "A101");
+	void* lecture_slot = lecture;
+	delete lecture;
+	Course_Type* lab = new Lab("02", "Monday", "12:00", 60, "Ann", "B202");
+	test::check(lab == lecture_slot, "a course type deleted through the base class is returned to its pool");
+	delete lab;
+
+	// a type larger than the slots of the pool is allocated (and freed) on the heap.
+	Object_Pool<Teacher>& pool = Object_Pool<Teacher>::get_instance();
+	const size_t slabs = pool.get_slab_count();
+	void* large = pool.allocate(sizeof(Large));
+	test::check(large != nullptr && pool.get_slab_count() == slabs, "a large object is not allocated from a slab");
+	pool.deallocate(large, sizeof(Large));
+	pool.deallocate(nullptr, sizeof(Teacher));
+
+	return test::result("Object_Pool");
+}
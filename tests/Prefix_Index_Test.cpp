@@ -0,0 +1,58 @@
+#include "Test.h"
+
+#include <string>
+#include <vector>
+
+#include "Prefix_Index.h"
+#include "Symbol_Table.h"
+#include "data/Course.h"
+
+// get the texts of the completions of a prefix.
+static std::vector<std::string> complete(const Prefix_Index& index, const std::string& prefix,
+                                         const size_t limit = 10) {
+	std::vector<std::string> texts{};
+	for (const Prefix_Index::Completion& completion : index.complete(prefix, limit)) {
+		texts.push_back(completion.text);
+	}
+	return texts;
+}
+
+int main() {
+	const size_t initial_size = Symbol_Table::get_instance().size();
+	Course physics("20000", "Physics", "Bob", 4);
+	Course phonics("20001", "Phonics", "Bob", 2);
+	Course algebra("10000", "Algebra", "Ann", 5);
+	{
+		Prefix_Index index{};
+		index.add(physics);
+		index.add(algebra);
+
+		// the completions are sorted by text, ids, names and lecturer names are completed.
+		test::check(complete(index, "Ph") == std::vector<std::string>{"Physics"}, "a course name is completed");
+		test::check(complete(index, "2") == std::vector<std::string>{"20000"}, "a course id is completed");
+		test::check(complete(index, "") == std::vector<std::string>{"10000", "20000", "Algebra", "Ann", "Bob",
+		                                                            "Physics"}, "the completions are sorted");
+		test::check(complete(index, "Ph", 0).empty(), "the limit bounds the completions");
+		test::check(complete(index, "Chem").empty(), "a prefix without entries has no completions");
+
+		// a course added later is completed (like Addcourse after the index was built).
+		index.add(phonics);
+		test::check(complete(index, "Ph") == std::vector<std::string>{"Phonics", "Physics"},
+		            "an added course is completed");
+		test::check(complete(index, "B") == std::vector<std::string>{"Bob"},
+		            "a lecturer of two courses is completed once");
+		index.add(phonics);
+		test::check(index.size() == 9, "adding a course again does not duplicate its entries");
+
+		// a removed course is not completed (like Rmcourse), the other courses of its lecturer are.
+		index.remove(physics);
+		test::check(complete(index, "Ph") == std::vector<std::string>{"Phonics"}, "a removed course is not completed");
+		test::check(complete(index, "B") == std::vector<std::string>{"Bob"},
+		            "a lecturer with a course left is completed");
+		index.remove(physics);
+		test::check(index.size() == 6, "removing a course again changes nothing");
+	}
+	test::check(Symbol_Table::get_instance().size() == initial_size, "the course ids are released with the index");
+
+	return test::result("Prefix_Index");
+}
@@ -0,0 +1,196 @@
+#include "Test.h"
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Catalog_Snapshot.h"
+#include "Journal.h"
+
+// how long a client waits for the output of the server before the check fails.
+static constexpr int output_timeout_ms = 5000;
+
+// a session of the server, like FinalProjectClient but it waits for each answer before the next line.
+class Client {
+	int m_fd{-1};
+	std::string m_output{}; // output of the server that was not taken by read_until yet.
+
+public:
+	// connect to the socket of the server, retrying while the server starts.
+	explicit Client(const std::string& path) {
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		for (int attempt = 0; attempt < 100 && m_fd < 0; attempt++) {
+			m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (connect(m_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0) { return; }
+			close(m_fd);
+			m_fd = -1;
+			std::this_thread::sleep_for(std::chrono::milliseconds{50});
+		}
+	}
+	// no copy since the client owns the connection.
+	Client(const Client&) = delete;
+	Client& operator=(const Client&) = delete;
+	~Client() {
+		if (m_fd >= 0) { close(m_fd); }
+	}
+
+	bool is_connected() const { return m_fd >= 0; }
+
+	// send a line to the session.
+	bool send_line(const std::string& line) {
+		const std::string data = line + '\n';
+		return m_fd >= 0 && send(m_fd, data.data(), data.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(data.size());
+	}
+
+	/**
+	 * read the output of the session up to a marker (the prompt of the next answer).
+	 * @param marker - text that ends the output.
+	 * @return the output up to and with the marker, or all the output if the marker did not come in time
+	 * (the connection was closed or the server did not answer).
+	 */
+	std::string read_until(const std::string& marker) {
+		while (m_output.find(marker) == std::string::npos) {
+			pollfd fd{m_fd, POLLIN, 0};
+			if (poll(&fd, 1, output_timeout_ms) <= 0) { break; }
+			char buffer[4096];
+			const ssize_t count = recv(m_fd, buffer, sizeof(buffer), 0);
+			if (count <= 0) { break; }
+			m_output.append(buffer, static_cast<size_t>(count));
+		}
+		const size_t end = m_output.find(marker);
+		const size_t size = end == std::string::npos ? m_output.size() : end + marker.size();
+		std::string output = m_output.substr(0, size);
+		m_output.erase(0, size);
+		return output;
+	}
+
+	// check if the server closed the session (after Exit).
+	bool is_closed() {
+		pollfd fd{m_fd, POLLIN, 0};
+		char buffer[4096];
+		while (poll(&fd, 1, output_timeout_ms) > 0) {
+			const ssize_t count = recv(m_fd, buffer, sizeof(buffer), 0);
+			if (count <= 0) { return count == 0; }
+		}
+		return false;
+	}
+};
+
+// write a file of the resources directory.
+static void write_resource(const std::string& file_name, const std::string& data) {
+	std::ofstream file(CSV_Editor::get_path(file_name), std::ios::trunc);
+	file << data;
+}
+
+// read a file of the resources directory.
+static std::string read_resource(const std::string& file_name) {
+	std::ifstream file(CSV_Editor::get_path(file_name));
+	return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+// log in a client as the admin, up to the prompt of the first command.
+static bool login_admin(Client& client) {
+	client.read_until("choose a user");
+	client.send_line("admin");
+	client.send_line("admin");
+	client.read_until("(yes or no)");
+	client.send_line("no");
+	return client.read_until("> ").find("Enter a command") != std::string::npos;
+}
+
+// the server is run from the working directory of the test, so it reads the resources of the test.
+// usage: Server_Test <path of FinalProject>
+int main(const int argc, char* argv[]) {
+	if (argc < 2) {
+		std::cerr << "usage: Server_Test <path of FinalProject>" << std::endl;
+		return EXIT_FAILURE;
+	}
+	for (const std::string& file_name : {Catalog_Snapshot::get_file_name(), Journal::get_file_name(),
+	                                     Journal::get_rotated_file_name(), std::string{"30000_lectures.csv"},
+	                                     std::string{"30000_tutorials.csv"}, std::string{"30000_labs.csv"}}) {
+		test::remove_resource(file_name);
+	}
+	write_resource("Students.csv", "111111111,Ann,pass1234\n");
+	write_resource("Teachers.csv", "123456789,Bob\n");
+	write_resource("Courses.csv", "10000,Algebra,123456789,5.000000\n");
+
+	// the socket is in a new temporary directory, so the test does not use the socket of a running server.
+	char socket_dir[] = "/tmp/server_test.XXXXXX";
+	if (!mkdtemp(socket_dir)) {
+		std::cerr << "Error: could not create a temporary directory: " << std::strerror(errno) << std::endl;
+		return EXIT_FAILURE;
+	}
+	const std::string socket_path = std::string{socket_dir} + "/scheduler.sock";
+	const pid_t server = fork();
+	if (server == 0) {
+		execl(argv[1], argv[1], "--server", socket_path.c_str(), static_cast<char*>(nullptr));
+		_exit(127);
+	}
+	test::check(server > 0, "the server is started");
+
+	if (server > 0) {
+		Client admin{socket_path};
+		Client student{socket_path};
+		Client rejected{socket_path};
+		test::check(admin.is_connected() && student.is_connected() && rejected.is_connected(),
+		            "several clients connect");
+
+		// login of the admin and a student, a wrong password is rejected.
+		test::check(login_admin(admin), "the admin logs in");
+		student.read_until("choose a user");
+		student.send_line("student");
+		student.read_until("student id");
+		student.send_line("111111111");
+		student.read_until("password");
+		student.send_line("pass1234");
+		test::check(student.read_until("> ").find("Enter a command") != std::string::npos, "the student logs in");
+		rejected.read_until("choose a user");
+		rejected.send_line("admin");
+		rejected.send_line("wrong");
+		test::check(rejected.read_until("choose a user").find("Invalid username or password") != std::string::npos,
+		            "a wrong password is rejected");
+
+		// a listing, and a mutation of one session that the other session sees.
+		student.send_line("Printcourse 10000");
+		test::check(student.read_until("> ").find("Algebra") != std::string::npos, "a session lists a course");
+		admin.send_line("Addcourse 30000 Chem 123456789 3.5");
+		admin.read_until("> ");
+		student.send_line("Printcourse 30000");
+		test::check(student.read_until("> ").find("Chem") != std::string::npos,
+		            "a session sees the course another session added");
+
+		// Exit ends only its session, the other sessions are still served.
+		admin.send_line("Exit");
+		test::check(admin.is_closed(), "Exit closes the session");
+		student.send_line("Printcourse 10000");
+		test::check(student.read_until("> ").find("Algebra") != std::string::npos,
+		            "the other sessions are served after an Exit");
+		student.send_line("Exit");
+		test::check(student.is_closed(), "Exit closes the last session");
+		test::check(read_resource("Courses.csv").find("30000,Chem") != std::string::npos,
+		            "Exit saves the catalog");
+
+		// the server saves the catalog and stops on SIGTERM.
+		kill(server, SIGTERM);
+		int status{};
+		waitpid(server, &status, 0);
+		test::check(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS, "the server stops on SIGTERM");
+	}
+	unlink(socket_path.c_str());
+	rmdir(socket_dir);
+	return test::result("Server");
+}
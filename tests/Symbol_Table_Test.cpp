@@ -0,0 +1,62 @@
+#include "Test.h"
+
+#include <string>
+
+#include "Entity_Order.h"
+#include "Symbol_Table.h"
+#include "data/course_types/Lecture.h"
+#include "schedule/Schedule.h"
+
+int main() {
+	Symbol_Table& table = Symbol_Table::get_instance();
+	const size_t initial_size = table.size();
+
+	// an id is interned once, and removed when its last reference is released.
+	const Symbol_Table::Handle handle = table.intern("symbol");
+	test::check(table.intern("symbol") == handle, "an id has one handle");
+	test::check(table.get_id(handle) == "symbol", "the handle has the id");
+	table.release(handle);
+	test::check(table.find("symbol") == handle, "an id with references stays in the table");
+	table.release(handle);
+	test::check(table.find("symbol") == Symbol_Table::no_handle, "an id without references is removed");
+	test::check(table.size() == initial_size, "the removed id is not counted");
+
+	// the handle of a removed id is reused by the next new id of its stripe.
+	const Symbol_Table::Handle reused = table.intern("symbol");
+	test::check(reused == handle, "the handle of a removed id is reused");
+	test::check(table.acquire(reused) == reused && table.get_id(reused) == "symbol", "acquire keeps the id");
+	table.release(reused);
+	table.release(reused);
+
+	// the ids of an order are released when they are removed, so adding and removing ids does not grow the table.
+	{
+		Entity_Order order{};
+		for (int round = 0; round < 10; round++) {
+			for (int i = 0; i < 100; i++) { order.push_back("round" + std::to_string(round) + "id" + std::to_string(i)); }
+			for (int i = 0; i < 100; i++) { order.erase("round" + std::to_string(round) + "id" + std::to_string(i)); }
+		}
+		order.push_back("kept");
+		test::check(table.size() == initial_size + 1, "the removed ids of an order are released");
+	}
+	test::check(table.size() == initial_size, "the ids of a destroyed order are released");
+
+	// a schedule holds a reference to the id of each of its courses, and a copy holds its own.
+	{
+		Schedule schedule{1};
+		schedule.add_course_type("90000", new Lecture("01", "Monday", "10:00", 90, "Bob", "A101"));
+		schedule.add_course_type("90000", new Lecture("02", "Monday", "12:00", 90, "Bob", "A101"));
+		test::check(table.size() == initial_size + 1, "a course id of a schedule is interned once");
+		{
+			const Schedule copy{schedule};
+			test::check(copy.get_course_type("90000", "02") != nullptr, "the copy finds its course by id");
+		}
+		schedule.remove_course_type("90000", "01");
+		test::check(table.find("90000") != Symbol_Table::no_handle, "a course with course types keeps its id");
+		schedule.remove_course_type("90000", "02");
+		test::check(table.find("90000") == Symbol_Table::no_handle, "a removed course releases its id");
+		schedule.add_course_type("90001", new Lecture("01", "Monday", "10:00", 90, "Bob", "A101"));
+	}
+	test::check(table.size() == initial_size, "the course ids of a destroyed schedule are released");
+
+	return test::result("Symbol_Table");
+}
@@ -0,0 +1,40 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "CSV_Editor.h"
+
+// minimal checks for the tests of the library (each test is a small executable run by ctest).
+// a failed check is printed and counted, the test returns the number of failed checks.
+namespace test {
+	inline int failures{};
+
+	/**
+	 * check a condition of a test.
+	 * @param condition - the condition that should hold.
+	 * @param description - what is checked (printed when the check fails).
+	 */
+	inline void check(const bool condition, const std::string& description) {
+		if (condition) { return; }
+		std::cerr << "FAILED: " << description << std::endl;
+		++failures;
+	}
+
+	// remove a file of the resources directory (if it exists), so each test starts from a clean state.
+	inline void remove_resource(const std::string& file_name) {
+		std::filesystem::remove(CSV_Editor::get_path(file_name));
+	}
+
+	// get the exit code of the test and print a summary.
+	inline int result(const std::string& name) {
+		std::cout << name << ": " << (failures == 0 ? "passed" : std::to_string(failures) + " checks failed")
+			<< std::endl;
+		return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+}
+
+#endif // TEST_H
@@ -0,0 +1,55 @@
+#include "Test.h"
+
+#include <string>
+#include <vector>
+
+#include "Version_List.h"
+
+// get the entities of a list in order.
+static std::vector<const int*> get_entities(const Version_List<int>& list) {
+	std::vector<const int*> entities{};
+	for (const Version_List<int>::Item& item : list) { entities.push_back(item.entity); }
+	return entities;
+}
+
+int main() {
+	// the entities of the list (the list does not own them).
+	std::vector<int> values(1000);
+	for (size_t i = 0; i < values.size(); i++) { values[i] = static_cast<int>(i); }
+	const int changed{-1};
+
+	Entity_Order order{};
+	Version_List<int> list{};
+	for (size_t i = 0; i < values.size(); i++) {
+		const std::string id = "version" + std::to_string(i);
+		order.push_back(id);
+		list.push_back(order.find_cursor(id), &values[i]);
+	}
+	test::check(list.size() == values.size(), "all entities are added");
+
+	// a copy is a published version, changing the list does not change it.
+	const Version_List<int> version{list};
+	test::check(list.replace(order.find_cursor("version10"), &changed), "an entity is replaced");
+	test::check(list.erase(order.find_cursor("version700")), "an entity is removed");
+	test::check(!list.erase(order.find_cursor("version700")), "a removed entity is removed once");
+
+	test::check(version.size() == values.size(), "the version keeps its size");
+	test::check(version.seek(order.find_cursor("version10"))->entity == &values[10],
+	            "the version keeps the replaced entity");
+	test::check(version.seek(order.find_cursor("version700"))->entity == &values[700],
+	            "the version keeps the removed entity");
+	const std::vector<const int*> entities = get_entities(version);
+	bool in_order{entities.size() == values.size()};
+	for (size_t i = 0; in_order && i < entities.size(); i++) { in_order = entities[i] == &values[i]; }
+	test::check(in_order, "the version is iterated in order");
+
+	test::check(list.size() == values.size() - 1, "the list does not count the removed entity");
+	test::check(list.seek(order.find_cursor("version10"))->entity == &changed, "the list has the new entity");
+	test::check(list.seek(order.find_cursor("version700"))->entity == &values[701],
+	            "the cursor of the removed entity points at the next entity");
+
+	// a cursor after the last entity is the end of the list.
+	test::check(list.seek(order.get_cursor(order.end())) == list.end(), "seek past the last entity is the end");
+
+	return test::result("Version_List");
+}